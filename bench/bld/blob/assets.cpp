@@ -0,0 +1,4128 @@
+#include "assets.hpp"
+namespace {
+alignas(16) constexpr unsigned char blob[] = {
+// app/file0.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*    asset 0 line  */
+0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, 0x3b, /* 0    var x0 = 0; */
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*                  */
+// app/file1.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*    asset 1 line  */
+0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, 0x3b, /* 0    var x0 = 0; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*     asset 1 line */
+0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, 0x20, 0x31, /*  1    var x1 = 1 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file2.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*    asset 2 line  */
+0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, 0x3b, /* 0    var x0 = 0; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*     asset 2 line */
+0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, 0x20, 0x32, /*  1    var x1 = 2 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x20, 0x6c, 0x69, 0x6e, /* ;    asset 2 lin */
+0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, /* e 2    var x2 =  */
+0x34, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 4;               */
+// app/file3.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*    asset 3 line  */
+0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, 0x3b, /* 0    var x0 = 0; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*     asset 3 line */
+0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, 0x20, 0x33, /*  1    var x1 = 3 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x20, 0x6c, 0x69, 0x6e, /* ;    asset 3 lin */
+0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, /* e 2    var x2 =  */
+0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x20, 0x6c, 0x69, /* 6;    asset 3 li */
+0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, /* ne 3    var x3 = */
+0x20, 0x39, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  9;              */
+// app/file4.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*    asset 4 line  */
+0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, 0x3b, /* 0    var x0 = 0; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*     asset 4 line */
+0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, 0x20, 0x34, /*  1    var x1 = 4 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x20, 0x6c, 0x69, 0x6e, /* ;    asset 4 lin */
+0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, /* e 2    var x2 =  */
+0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x20, 0x6c, 0x69, /* 8;    asset 4 li */
+0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, /* ne 3    var x3 = */
+0x20, 0x31, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x20, /*  12;    asset 4  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, /* line 4    var x4 */
+0x20, 0x3d, 0x20, 0x31, 0x36, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 16;           */
+// app/file5.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*    asset 5 line  */
+0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, 0x3b, /* 0    var x0 = 0; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*     asset 5 line */
+0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, 0x20, 0x35, /*  1    var x1 = 5 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x20, 0x6c, 0x69, 0x6e, /* ;    asset 5 lin */
+0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, /* e 2    var x2 =  */
+0x31, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x20, 0x6c, /* 10;    asset 5 l */
+0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, /* ine 3    var x3  */
+0x3d, 0x20, 0x31, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, /* = 15;    asset 5 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 4    var x */
+0x34, 0x20, 0x3d, 0x20, 0x32, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 4 = 20;    asset */
+0x20, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, /*  5 line 5    var */
+0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x32, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  x5 = 25;        */
+// app/file6.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*    asset 6 line  */
+0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, 0x3b, /* 0    var x0 = 0; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*     asset 6 line */
+0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, 0x20, 0x36, /*  1    var x1 = 6 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x20, 0x6c, 0x69, 0x6e, /* ;    asset 6 lin */
+0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, /* e 2    var x2 =  */
+0x31, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x20, 0x6c, /* 12;    asset 6 l */
+0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, /* ine 3    var x3  */
+0x3d, 0x20, 0x31, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, /* = 18;    asset 6 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 4    var x */
+0x34, 0x20, 0x3d, 0x20, 0x32, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 4 = 24;    asset */
+0x20, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, /*  6 line 5    var */
+0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x33, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, /*  x5 = 30;    ass */
+0x65, 0x74, 0x20, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* et 6 line 6    v */
+0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x33, 0x36, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, /* ar x6 = 36;      */
+// app/file7.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*    asset 7 line  */
+0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, 0x3b, /* 0    var x0 = 0; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*     asset 7 line */
+0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, 0x20, 0x37, /*  1    var x1 = 7 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x20, 0x6c, 0x69, 0x6e, /* ;    asset 7 lin */
+0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, /* e 2    var x2 =  */
+0x31, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x20, 0x6c, /* 14;    asset 7 l */
+0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, /* ine 3    var x3  */
+0x3d, 0x20, 0x32, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, /* = 21;    asset 7 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 4    var x */
+0x34, 0x20, 0x3d, 0x20, 0x32, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 4 = 28;    asset */
+0x20, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, /*  7 line 5    var */
+0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x33, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, /*  x5 = 35;    ass */
+0x65, 0x74, 0x20, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* et 7 line 6    v */
+0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x34, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* ar x6 = 42;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, /* sset 7 line 7    */
+0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x37, 0x20, 0x3d, 0x20, 0x34, 0x39, 0x3b, 0x0a, 0x00, 0x00, /*  var x7 = 49;    */
+// app/file8.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*    asset 8 line  */
+0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, 0x3b, /* 0    var x0 = 0; */
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*                  */
+// app/file9.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*    asset 9 line  */
+0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, 0x3b, /* 0    var x0 = 0; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*     asset 9 line */
+0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, 0x20, 0x39, /*  1    var x1 = 9 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file10.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 10 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x20, 0x6c, 0x69, /* ;    asset 10 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x31, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, /*  10;    asset 10 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x32, 0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 2 = 20;          */
+// app/file11.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 11 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x20, 0x6c, 0x69, /* ;    asset 11 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x31, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, /*  11;    asset 11 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x32, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 22;    asset */
+0x20, 0x31, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  11 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x33, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, /* r x3 = 33;       */
+// app/file12.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 12 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x20, 0x6c, 0x69, /* ;    asset 12 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x31, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, /*  12;    asset 12 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x32, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 24;    asset */
+0x20, 0x31, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  12 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, /* r x3 = 36;    as */
+0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, /* set 12 line 4    */
+0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x34, 0x38, 0x3b, 0x0a, 0x00, 0x00, /*  var x4 = 48;    */
+// app/file13.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 13 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x20, 0x6c, 0x69, /* ;    asset 13 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x31, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, /*  13;    asset 13 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x32, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 26;    asset */
+0x20, 0x31, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  13 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, /* r x3 = 39;    as */
+0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, /* set 13 line 4    */
+0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x35, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, /*  var x4 = 52;    */
+0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, /*  asset 13 line 5 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x36, 0x35, 0x3b, /*     var x5 = 65; */
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*                  */
+// app/file14.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 14 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x20, 0x6c, 0x69, /* ;    asset 14 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x31, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, /*  14;    asset 14 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x32, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 28;    asset */
+0x20, 0x31, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  14 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, /* r x3 = 42;    as */
+0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, /* set 14 line 4    */
+0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x35, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, /*  var x4 = 56;    */
+0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, /*  asset 14 line 5 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x37, 0x30, 0x3b, /*     var x5 = 70; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*     asset 14 lin */
+0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, /* e 6    var x6 =  */
+0x38, 0x34, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 84;              */
+// app/file15.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 15 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x20, 0x6c, 0x69, /* ;    asset 15 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x31, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, /*  15;    asset 15 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x33, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 30;    asset */
+0x20, 0x31, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  15 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, /* r x3 = 45;    as */
+0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, /* set 15 line 4    */
+0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x36, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, /*  var x4 = 60;    */
+0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, /*  asset 15 line 5 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x37, 0x35, 0x3b, /*     var x5 = 75; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*     asset 15 lin */
+0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, /* e 6    var x6 =  */
+0x39, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x20, /* 90;    asset 15  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x37, /* line 7    var x7 */
+0x20, 0x3d, 0x20, 0x31, 0x30, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 105;          */
+// app/file16.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 16 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file17.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 17 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x20, 0x6c, 0x69, /* ;    asset 17 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x31, 0x37, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  17;             */
+// app/file18.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 18 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x20, 0x6c, 0x69, /* ;    asset 18 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x31, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, /*  18;    asset 18 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x33, 0x36, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 2 = 36;          */
+// app/file19.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 19 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x20, 0x6c, 0x69, /* ;    asset 19 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x31, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, /*  19;    asset 19 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x33, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 38;    asset */
+0x20, 0x31, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  19 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x37, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, /* r x3 = 57;       */
+// app/file20.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 20 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x20, 0x6c, 0x69, /* ;    asset 20 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x32, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, /*  20;    asset 20 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x34, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 40;    asset */
+0x20, 0x32, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  20 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, /* r x3 = 60;    as */
+0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, /* set 20 line 4    */
+0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x38, 0x30, 0x3b, 0x0a, 0x00, 0x00, /*  var x4 = 80;    */
+// app/file21.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 21 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x20, 0x6c, 0x69, /* ;    asset 21 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x32, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, /*  21;    asset 21 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x34, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 42;    asset */
+0x20, 0x32, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  21 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, /* r x3 = 63;    as */
+0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, /* set 21 line 4    */
+0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x38, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, /*  var x4 = 84;    */
+0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, /*  asset 21 line 5 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x35, /*     var x5 = 105 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file22.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 22 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x20, 0x6c, 0x69, /* ;    asset 22 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x32, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, /*  22;    asset 22 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x34, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 44;    asset */
+0x20, 0x32, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  22 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, /* r x3 = 66;    as */
+0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, /* set 22 line 4    */
+0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x38, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, /*  var x4 = 88;    */
+0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, /*  asset 22 line 5 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x30, /*     var x5 = 110 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x20, 0x6c, 0x69, /* ;    asset 22 li */
+0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, /* ne 6    var x6 = */
+0x20, 0x31, 0x33, 0x32, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  132;            */
+// app/file23.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 23 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x20, 0x6c, 0x69, /* ;    asset 23 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x32, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, /*  23;    asset 23 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x34, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 46;    asset */
+0x20, 0x32, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  23 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, /* r x3 = 69;    as */
+0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, /* set 23 line 4    */
+0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x39, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, /*  var x4 = 92;    */
+0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, /*  asset 23 line 5 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x35, /*     var x5 = 115 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x20, 0x6c, 0x69, /* ;    asset 23 li */
+0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, /* ne 6    var x6 = */
+0x20, 0x31, 0x33, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, /*  138;    asset 2 */
+0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, /* 3 line 7    var  */
+0x78, 0x37, 0x20, 0x3d, 0x20, 0x31, 0x36, 0x31, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* x7 = 161;        */
+// app/file24.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 24 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file25.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 25 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x20, 0x6c, 0x69, /* ;    asset 25 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x32, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  25;             */
+// app/file26.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 26 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x20, 0x6c, 0x69, /* ;    asset 26 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x32, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, /*  26;    asset 26 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x35, 0x32, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 2 = 52;          */
+// app/file27.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 27 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x20, 0x6c, 0x69, /* ;    asset 27 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x32, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, /*  27;    asset 27 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x35, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 54;    asset */
+0x20, 0x32, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  27 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x31, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, /* r x3 = 81;       */
+// app/file28.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 28 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x20, 0x6c, 0x69, /* ;    asset 28 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x32, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, /*  28;    asset 28 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x35, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 56;    asset */
+0x20, 0x32, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  28 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, /* r x3 = 84;    as */
+0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, /* set 28 line 4    */
+0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x32, 0x3b, 0x0a, 0x00, /*  var x4 = 112;   */
+// app/file29.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 29 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x20, 0x6c, 0x69, /* ;    asset 29 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x32, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, /*  29;    asset 29 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x35, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 58;    asset */
+0x20, 0x32, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  29 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, /* r x3 = 87;    as */
+0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, /* set 29 line 4    */
+0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x36, 0x3b, 0x0a, 0x2f, /*  var x4 = 116;   */
+0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*   asset 29 line  */
+0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x34, /* 5    var x5 = 14 */
+0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 5;               */
+// app/file30.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 30 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x30, 0x20, 0x6c, 0x69, /* ;    asset 30 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x33, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x30, /*  30;    asset 30 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x36, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 60;    asset */
+0x20, 0x33, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  30 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x39, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, /* r x3 = 90;    as */
+0x73, 0x65, 0x74, 0x20, 0x33, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, /* set 30 line 4    */
+0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x30, 0x3b, 0x0a, 0x2f, /*  var x4 = 120;   */
+0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*   asset 30 line  */
+0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x35, /* 5    var x5 = 15 */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x30, 0x20, 0x6c, /* 0;    asset 30 l */
+0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, /* ine 6    var x6  */
+0x3d, 0x20, 0x31, 0x38, 0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 180;           */
+// app/file31.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 31 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x31, 0x20, 0x6c, 0x69, /* ;    asset 31 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x33, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x31, /*  31;    asset 31 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x36, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 62;    asset */
+0x20, 0x33, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  31 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x39, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, /* r x3 = 93;    as */
+0x73, 0x65, 0x74, 0x20, 0x33, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, /* set 31 line 4    */
+0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x34, 0x3b, 0x0a, 0x2f, /*  var x4 = 124;   */
+0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*   asset 31 line  */
+0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x35, /* 5    var x5 = 15 */
+0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x31, 0x20, 0x6c, /* 5;    asset 31 l */
+0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, /* ine 6    var x6  */
+0x3d, 0x20, 0x31, 0x38, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 186;    asset  */
+0x33, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, /* 31 line 7    var */
+0x20, 0x78, 0x37, 0x20, 0x3d, 0x20, 0x32, 0x31, 0x37, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, /*  x7 = 217;       */
+// app/file32.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 32 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file33.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 33 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x33, 0x20, 0x6c, 0x69, /* ;    asset 33 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x33, 0x33, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  33;             */
+// app/file34.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 34 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x34, 0x20, 0x6c, 0x69, /* ;    asset 34 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x33, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x34, /*  34;    asset 34 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x36, 0x38, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 2 = 68;          */
+// app/file35.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 35 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x35, 0x20, 0x6c, 0x69, /* ;    asset 35 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x33, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x35, /*  35;    asset 35 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x37, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 70;    asset */
+0x20, 0x33, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  35 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, /* r x3 = 105;      */
+// app/file36.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 36 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x36, 0x20, 0x6c, 0x69, /* ;    asset 36 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x33, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x36, /*  36;    asset 36 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x37, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 72;    asset */
+0x20, 0x33, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  36 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x3 = 108;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, /* sset 36 line 4   */
+0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x31, 0x34, 0x34, 0x3b, 0x0a, /*   var x4 = 144;  */
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*                  */
+// app/file37.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 37 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x37, 0x20, 0x6c, 0x69, /* ;    asset 37 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x33, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x37, /*  37;    asset 37 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x37, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 74;    asset */
+0x20, 0x33, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  37 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x3 = 111;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, /* sset 37 line 4   */
+0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x31, 0x34, 0x38, 0x3b, 0x0a, /*   var x4 = 148;  */
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 37 line */
+0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, /*  5    var x5 = 1 */
+0x38, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 85;              */
+// app/file38.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 38 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x38, 0x20, 0x6c, 0x69, /* ;    asset 38 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x33, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x38, /*  38;    asset 38 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x37, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 76;    asset */
+0x20, 0x33, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  38 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x3 = 114;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, /* sset 38 line 4   */
+0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x31, 0x35, 0x32, 0x3b, 0x0a, /*   var x4 = 152;  */
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 38 line */
+0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, /*  5    var x5 = 1 */
+0x39, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x38, 0x20, /* 90;    asset 38  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, /* line 6    var x6 */
+0x20, 0x3d, 0x20, 0x32, 0x32, 0x38, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 228;          */
+// app/file39.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 39 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x39, 0x20, 0x6c, 0x69, /* ;    asset 39 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x33, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x39, /*  39;    asset 39 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x37, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 78;    asset */
+0x20, 0x33, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  39 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x3 = 117;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, /* sset 39 line 4   */
+0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x31, 0x35, 0x36, 0x3b, 0x0a, /*   var x4 = 156;  */
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 39 line */
+0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, /*  5    var x5 = 1 */
+0x39, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x33, 0x39, 0x20, /* 95;    asset 39  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, /* line 6    var x6 */
+0x20, 0x3d, 0x20, 0x32, 0x33, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 234;    asset */
+0x20, 0x33, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  39 line 7    va */
+0x72, 0x20, 0x78, 0x37, 0x20, 0x3d, 0x20, 0x32, 0x37, 0x33, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, /* r x7 = 273;      */
+// app/file40.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 40 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file41.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 41 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x31, 0x20, 0x6c, 0x69, /* ;    asset 41 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x34, 0x31, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  41;             */
+// app/file42.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 42 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x32, 0x20, 0x6c, 0x69, /* ;    asset 42 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x34, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x32, /*  42;    asset 42 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x38, 0x34, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 2 = 84;          */
+// app/file43.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 43 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x33, 0x20, 0x6c, 0x69, /* ;    asset 43 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x34, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x33, /*  43;    asset 43 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x38, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 86;    asset */
+0x20, 0x34, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  43 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x39, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, /* r x3 = 129;      */
+// app/file44.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 44 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x34, 0x20, 0x6c, 0x69, /* ;    asset 44 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x34, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x34, /*  44;    asset 44 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x38, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 88;    asset */
+0x20, 0x34, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  44 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x31, 0x33, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x3 = 132;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, /* sset 44 line 4   */
+0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x31, 0x37, 0x36, 0x3b, 0x0a, /*   var x4 = 176;  */
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*                  */
+// app/file45.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 45 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x35, 0x20, 0x6c, 0x69, /* ;    asset 45 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x34, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x35, /*  45;    asset 45 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x39, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 90;    asset */
+0x20, 0x34, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  45 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x31, 0x33, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x3 = 135;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, /* sset 45 line 4   */
+0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x31, 0x38, 0x30, 0x3b, 0x0a, /*   var x4 = 180;  */
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 45 line */
+0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x32, /*  5    var x5 = 2 */
+0x32, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 25;              */
+// app/file46.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 46 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x36, 0x20, 0x6c, 0x69, /* ;    asset 46 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x34, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x36, /*  46;    asset 46 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x39, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 92;    asset */
+0x20, 0x34, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  46 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x31, 0x33, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x3 = 138;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, /* sset 46 line 4   */
+0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x31, 0x38, 0x34, 0x3b, 0x0a, /*   var x4 = 184;  */
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 46 line */
+0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x32, /*  5    var x5 = 2 */
+0x33, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x36, 0x20, /* 30;    asset 46  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, /* line 6    var x6 */
+0x20, 0x3d, 0x20, 0x32, 0x37, 0x36, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 276;          */
+// app/file47.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 47 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x37, 0x20, 0x6c, 0x69, /* ;    asset 47 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x34, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x37, /*  47;    asset 47 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x39, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* 2 = 94;    asset */
+0x20, 0x34, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  47 line 3    va */
+0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x31, 0x34, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x3 = 141;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, /* sset 47 line 4   */
+0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x31, 0x38, 0x38, 0x3b, 0x0a, /*   var x4 = 188;  */
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 47 line */
+0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x32, /*  5    var x5 = 2 */
+0x33, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x37, 0x20, /* 35;    asset 47  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, /* line 6    var x6 */
+0x20, 0x3d, 0x20, 0x32, 0x38, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 282;    asset */
+0x20, 0x34, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /*  47 line 7    va */
+0x72, 0x20, 0x78, 0x37, 0x20, 0x3d, 0x20, 0x33, 0x32, 0x39, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, /* r x7 = 329;      */
+// app/file48.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 48 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file49.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 49 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x34, 0x39, 0x20, 0x6c, 0x69, /* ;    asset 49 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x34, 0x39, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  49;             */
+// app/file50.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 50 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x30, 0x20, 0x6c, 0x69, /* ;    asset 50 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x35, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x30, /*  50;    asset 50 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 2 = 100;         */
+// app/file51.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 51 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x31, 0x20, 0x6c, 0x69, /* ;    asset 51 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x35, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x31, /*  51;    asset 51 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 102;    asse */
+0x74, 0x20, 0x35, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 51 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x31, 0x35, 0x33, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x3 = 153;     */
+// app/file52.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 52 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x32, 0x20, 0x6c, 0x69, /* ;    asset 52 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x35, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x32, /*  52;    asset 52 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 104;    asse */
+0x74, 0x20, 0x35, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 52 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x31, 0x35, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 156;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 52 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x32, 0x30, 0x38, 0x3b, /*    var x4 = 208; */
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*                  */
+// app/file53.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 53 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x33, 0x20, 0x6c, 0x69, /* ;    asset 53 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x35, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x33, /*  53;    asset 53 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 106;    asse */
+0x74, 0x20, 0x35, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 53 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x31, 0x35, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 159;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 53 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x32, 0x31, 0x32, 0x3b, /*    var x4 = 212; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*     asset 53 lin */
+0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, /* e 5    var x5 =  */
+0x32, 0x36, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 265;             */
+// app/file54.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 54 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x34, 0x20, 0x6c, 0x69, /* ;    asset 54 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x35, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x34, /*  54;    asset 54 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 108;    asse */
+0x74, 0x20, 0x35, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 54 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x31, 0x36, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 162;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 54 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x32, 0x31, 0x36, 0x3b, /*    var x4 = 216; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*     asset 54 lin */
+0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, /* e 5    var x5 =  */
+0x32, 0x37, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x34, /* 270;    asset 54 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 6    var x */
+0x36, 0x20, 0x3d, 0x20, 0x33, 0x32, 0x34, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 6 = 324;         */
+// app/file55.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 55 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x35, 0x20, 0x6c, 0x69, /* ;    asset 55 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x35, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x35, /*  55;    asset 55 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 110;    asse */
+0x74, 0x20, 0x35, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 55 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x31, 0x36, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 165;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 55 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x32, 0x32, 0x30, 0x3b, /*    var x4 = 220; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*     asset 55 lin */
+0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, /* e 5    var x5 =  */
+0x32, 0x37, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x35, /* 275;    asset 55 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 6    var x */
+0x36, 0x20, 0x3d, 0x20, 0x33, 0x33, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 6 = 330;    asse */
+0x74, 0x20, 0x35, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 55 line 7    v */
+0x61, 0x72, 0x20, 0x78, 0x37, 0x20, 0x3d, 0x20, 0x33, 0x38, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x7 = 385;     */
+// app/file56.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 56 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file57.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 57 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x37, 0x20, 0x6c, 0x69, /* ;    asset 57 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x35, 0x37, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  57;             */
+// app/file58.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 58 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x38, 0x20, 0x6c, 0x69, /* ;    asset 58 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x35, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x38, /*  58;    asset 58 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x36, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 2 = 116;         */
+// app/file59.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 59 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x39, 0x20, 0x6c, 0x69, /* ;    asset 59 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x35, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x35, 0x39, /*  59;    asset 59 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 118;    asse */
+0x74, 0x20, 0x35, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 59 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x31, 0x37, 0x37, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x3 = 177;     */
+// app/file60.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 60 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x30, 0x20, 0x6c, 0x69, /* ;    asset 60 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x36, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x30, /*  60;    asset 60 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 120;    asse */
+0x74, 0x20, 0x36, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 60 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x31, 0x38, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 180;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 60 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x32, 0x34, 0x30, 0x3b, /*    var x4 = 240; */
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*                  */
+// app/file61.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 61 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x31, 0x20, 0x6c, 0x69, /* ;    asset 61 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x36, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x31, /*  61;    asset 61 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 122;    asse */
+0x74, 0x20, 0x36, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 61 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x31, 0x38, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 183;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 61 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x32, 0x34, 0x34, 0x3b, /*    var x4 = 244; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*     asset 61 lin */
+0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, /* e 5    var x5 =  */
+0x33, 0x30, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 305;             */
+// app/file62.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 62 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x32, 0x20, 0x6c, 0x69, /* ;    asset 62 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x36, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x32, /*  62;    asset 62 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 124;    asse */
+0x74, 0x20, 0x36, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 62 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x31, 0x38, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 186;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 62 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x32, 0x34, 0x38, 0x3b, /*    var x4 = 248; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x32, 0x20, 0x6c, 0x69, 0x6e, /*     asset 62 lin */
+0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, /* e 5    var x5 =  */
+0x33, 0x31, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x32, /* 310;    asset 62 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 6    var x */
+0x36, 0x20, 0x3d, 0x20, 0x33, 0x37, 0x32, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 6 = 372;         */
+// app/file63.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 63 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x33, 0x20, 0x6c, 0x69, /* ;    asset 63 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x36, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x33, /*  63;    asset 63 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 126;    asse */
+0x74, 0x20, 0x36, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 63 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x31, 0x38, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 189;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 63 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x32, 0x35, 0x32, 0x3b, /*    var x4 = 252; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*     asset 63 lin */
+0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, /* e 5    var x5 =  */
+0x33, 0x31, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x33, /* 315;    asset 63 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 6    var x */
+0x36, 0x20, 0x3d, 0x20, 0x33, 0x37, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 6 = 378;    asse */
+0x74, 0x20, 0x36, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 63 line 7    v */
+0x61, 0x72, 0x20, 0x78, 0x37, 0x20, 0x3d, 0x20, 0x34, 0x34, 0x31, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x7 = 441;     */
+// app/file64.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 64 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file65.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 65 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x35, 0x20, 0x6c, 0x69, /* ;    asset 65 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x36, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  65;             */
+// app/file66.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 66 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x36, 0x20, 0x6c, 0x69, /* ;    asset 66 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x36, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x36, /*  66;    asset 66 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x33, 0x32, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 2 = 132;         */
+// app/file67.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 67 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x37, 0x20, 0x6c, 0x69, /* ;    asset 67 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x36, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x37, /*  67;    asset 67 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x33, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 134;    asse */
+0x74, 0x20, 0x36, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 67 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x32, 0x30, 0x31, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x3 = 201;     */
+// app/file68.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 68 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x38, 0x20, 0x6c, 0x69, /* ;    asset 68 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x36, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x38, /*  68;    asset 68 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x33, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 136;    asse */
+0x74, 0x20, 0x36, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 68 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x32, 0x30, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 204;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 68 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x32, 0x37, 0x32, 0x3b, /*    var x4 = 272; */
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*                  */
+// app/file69.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 69 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x39, 0x20, 0x6c, 0x69, /* ;    asset 69 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x36, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x39, /*  69;    asset 69 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x33, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 138;    asse */
+0x74, 0x20, 0x36, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 69 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x32, 0x30, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 207;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 69 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x32, 0x37, 0x36, 0x3b, /*    var x4 = 276; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x36, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*     asset 69 lin */
+0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, /* e 5    var x5 =  */
+0x33, 0x34, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 345;             */
+// app/file70.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 70 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x30, 0x20, 0x6c, 0x69, /* ;    asset 70 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x37, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x30, /*  70;    asset 70 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x34, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 140;    asse */
+0x74, 0x20, 0x37, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 70 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x32, 0x31, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 210;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 70 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x32, 0x38, 0x30, 0x3b, /*    var x4 = 280; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x30, 0x20, 0x6c, 0x69, 0x6e, /*     asset 70 lin */
+0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, /* e 5    var x5 =  */
+0x33, 0x35, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x30, /* 350;    asset 70 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 6    var x */
+0x36, 0x20, 0x3d, 0x20, 0x34, 0x32, 0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 6 = 420;         */
+// app/file71.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 71 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x31, 0x20, 0x6c, 0x69, /* ;    asset 71 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x37, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x31, /*  71;    asset 71 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x34, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 142;    asse */
+0x74, 0x20, 0x37, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 71 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x32, 0x31, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 213;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 71 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x32, 0x38, 0x34, 0x3b, /*    var x4 = 284; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*     asset 71 lin */
+0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, /* e 5    var x5 =  */
+0x33, 0x35, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x31, /* 355;    asset 71 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 6    var x */
+0x36, 0x20, 0x3d, 0x20, 0x34, 0x32, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 6 = 426;    asse */
+0x74, 0x20, 0x37, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 71 line 7    v */
+0x61, 0x72, 0x20, 0x78, 0x37, 0x20, 0x3d, 0x20, 0x34, 0x39, 0x37, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x7 = 497;     */
+// app/file72.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 72 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file73.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 73 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x33, 0x20, 0x6c, 0x69, /* ;    asset 73 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x37, 0x33, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  73;             */
+// app/file74.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 74 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x34, 0x20, 0x6c, 0x69, /* ;    asset 74 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x37, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x34, /*  74;    asset 74 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x34, 0x38, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 2 = 148;         */
+// app/file75.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 75 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x35, 0x20, 0x6c, 0x69, /* ;    asset 75 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x37, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x35, /*  75;    asset 75 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x35, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 150;    asse */
+0x74, 0x20, 0x37, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 75 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x32, 0x32, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x3 = 225;     */
+// app/file76.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 76 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x36, 0x20, 0x6c, 0x69, /* ;    asset 76 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x37, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x36, /*  76;    asset 76 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x35, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 152;    asse */
+0x74, 0x20, 0x37, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 76 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x32, 0x32, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 228;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 76 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x33, 0x30, 0x34, 0x3b, /*    var x4 = 304; */
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*                  */
+// app/file77.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 77 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x37, 0x20, 0x6c, 0x69, /* ;    asset 77 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x37, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x37, /*  77;    asset 77 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x35, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 154;    asse */
+0x74, 0x20, 0x37, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 77 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x32, 0x33, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 231;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 77 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x33, 0x30, 0x38, 0x3b, /*    var x4 = 308; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*     asset 77 lin */
+0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, /* e 5    var x5 =  */
+0x33, 0x38, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 385;             */
+// app/file78.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 78 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x38, 0x20, 0x6c, 0x69, /* ;    asset 78 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x37, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x38, /*  78;    asset 78 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x35, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 156;    asse */
+0x74, 0x20, 0x37, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 78 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x32, 0x33, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 234;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 78 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x33, 0x31, 0x32, 0x3b, /*    var x4 = 312; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x38, 0x20, 0x6c, 0x69, 0x6e, /*     asset 78 lin */
+0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, /* e 5    var x5 =  */
+0x33, 0x39, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x38, /* 390;    asset 78 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 6    var x */
+0x36, 0x20, 0x3d, 0x20, 0x34, 0x36, 0x38, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 6 = 468;         */
+// app/file79.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 79 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x39, 0x20, 0x6c, 0x69, /* ;    asset 79 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x37, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x39, /*  79;    asset 79 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x35, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 158;    asse */
+0x74, 0x20, 0x37, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 79 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x32, 0x33, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 237;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 79 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x33, 0x31, 0x36, 0x3b, /*    var x4 = 316; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*     asset 79 lin */
+0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, /* e 5    var x5 =  */
+0x33, 0x39, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x37, 0x39, /* 395;    asset 79 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 6    var x */
+0x36, 0x20, 0x3d, 0x20, 0x34, 0x37, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 6 = 474;    asse */
+0x74, 0x20, 0x37, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 79 line 7    v */
+0x61, 0x72, 0x20, 0x78, 0x37, 0x20, 0x3d, 0x20, 0x35, 0x35, 0x33, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x7 = 553;     */
+// app/file80.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 80 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file81.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 81 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x31, 0x20, 0x6c, 0x69, /* ;    asset 81 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x38, 0x31, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  81;             */
+// app/file82.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 82 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x32, 0x20, 0x6c, 0x69, /* ;    asset 82 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x38, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x32, /*  82;    asset 82 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x36, 0x34, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 2 = 164;         */
+// app/file83.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 83 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x33, 0x20, 0x6c, 0x69, /* ;    asset 83 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x38, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x33, /*  83;    asset 83 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x36, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 166;    asse */
+0x74, 0x20, 0x38, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 83 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x32, 0x34, 0x39, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x3 = 249;     */
+// app/file84.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 84 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x34, 0x20, 0x6c, 0x69, /* ;    asset 84 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x38, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x34, /*  84;    asset 84 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x36, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 168;    asse */
+0x74, 0x20, 0x38, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 84 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x32, 0x35, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 252;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 84 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x33, 0x33, 0x36, 0x3b, /*    var x4 = 336; */
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*                  */
+// app/file85.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 85 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x35, 0x20, 0x6c, 0x69, /* ;    asset 85 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x38, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x35, /*  85;    asset 85 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x37, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 170;    asse */
+0x74, 0x20, 0x38, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 85 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x32, 0x35, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 255;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 85 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x33, 0x34, 0x30, 0x3b, /*    var x4 = 340; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*     asset 85 lin */
+0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, /* e 5    var x5 =  */
+0x34, 0x32, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 425;             */
+// app/file86.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 86 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x36, 0x20, 0x6c, 0x69, /* ;    asset 86 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x38, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x36, /*  86;    asset 86 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x37, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 172;    asse */
+0x74, 0x20, 0x38, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 86 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x32, 0x35, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 258;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 86 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x33, 0x34, 0x34, 0x3b, /*    var x4 = 344; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x36, 0x20, 0x6c, 0x69, 0x6e, /*     asset 86 lin */
+0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, /* e 5    var x5 =  */
+0x34, 0x33, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x36, /* 430;    asset 86 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 6    var x */
+0x36, 0x20, 0x3d, 0x20, 0x35, 0x31, 0x36, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 6 = 516;         */
+// app/file87.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 87 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x37, 0x20, 0x6c, 0x69, /* ;    asset 87 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x38, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x37, /*  87;    asset 87 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x37, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 174;    asse */
+0x74, 0x20, 0x38, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 87 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x32, 0x36, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 261;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 87 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x33, 0x34, 0x38, 0x3b, /*    var x4 = 348; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*     asset 87 lin */
+0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, /* e 5    var x5 =  */
+0x34, 0x33, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x37, /* 435;    asset 87 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 6    var x */
+0x36, 0x20, 0x3d, 0x20, 0x35, 0x32, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 6 = 522;    asse */
+0x74, 0x20, 0x38, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 87 line 7    v */
+0x61, 0x72, 0x20, 0x78, 0x37, 0x20, 0x3d, 0x20, 0x36, 0x30, 0x39, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x7 = 609;     */
+// app/file88.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 88 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file89.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 89 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x38, 0x39, 0x20, 0x6c, 0x69, /* ;    asset 89 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x38, 0x39, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  89;             */
+// app/file90.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 90 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x30, 0x20, 0x6c, 0x69, /* ;    asset 90 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x39, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x30, /*  90;    asset 90 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x38, 0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 2 = 180;         */
+// app/file91.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 91 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x31, 0x20, 0x6c, 0x69, /* ;    asset 91 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x39, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x31, /*  91;    asset 91 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x38, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 182;    asse */
+0x74, 0x20, 0x39, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 91 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x32, 0x37, 0x33, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x3 = 273;     */
+// app/file92.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 92 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x32, 0x20, 0x6c, 0x69, /* ;    asset 92 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x39, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x32, /*  92;    asset 92 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x38, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 184;    asse */
+0x74, 0x20, 0x39, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 92 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x32, 0x37, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 276;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 92 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x33, 0x36, 0x38, 0x3b, /*    var x4 = 368; */
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*                  */
+// app/file93.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 93 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x33, 0x20, 0x6c, 0x69, /* ;    asset 93 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x39, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x33, /*  93;    asset 93 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x38, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 186;    asse */
+0x74, 0x20, 0x39, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 93 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x32, 0x37, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 279;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 93 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x33, 0x37, 0x32, 0x3b, /*    var x4 = 372; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*     asset 93 lin */
+0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, /* e 5    var x5 =  */
+0x34, 0x36, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 465;             */
+// app/file94.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 94 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x34, 0x20, 0x6c, 0x69, /* ;    asset 94 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x39, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x34, /*  94;    asset 94 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x38, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 188;    asse */
+0x74, 0x20, 0x39, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 94 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x32, 0x38, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 282;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 94 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x33, 0x37, 0x36, 0x3b, /*    var x4 = 376; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*     asset 94 lin */
+0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, /* e 5    var x5 =  */
+0x34, 0x37, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x34, /* 470;    asset 94 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 6    var x */
+0x36, 0x20, 0x3d, 0x20, 0x35, 0x36, 0x34, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 6 = 564;         */
+// app/file95.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 95 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x35, 0x20, 0x6c, 0x69, /* ;    asset 95 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x39, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x35, /*  95;    asset 95 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x39, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 190;    asse */
+0x74, 0x20, 0x39, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 95 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x32, 0x38, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x3 = 285;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, /* asset 95 line 4  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, 0x3d, 0x20, 0x33, 0x38, 0x30, 0x3b, /*    var x4 = 380; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*     asset 95 lin */
+0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, /* e 5    var x5 =  */
+0x34, 0x37, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x35, /* 475;    asset 95 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 6    var x */
+0x36, 0x20, 0x3d, 0x20, 0x35, 0x37, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 6 = 570;    asse */
+0x74, 0x20, 0x39, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 95 line 7    v */
+0x61, 0x72, 0x20, 0x78, 0x37, 0x20, 0x3d, 0x20, 0x36, 0x36, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x7 = 665;     */
+// app/file96.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 96 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file97.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 97 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x37, 0x20, 0x6c, 0x69, /* ;    asset 97 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x39, 0x37, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  97;             */
+// app/file98.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 98 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x38, 0x20, 0x6c, 0x69, /* ;    asset 98 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x39, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x38, /*  98;    asset 98 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x39, 0x36, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 2 = 196;         */
+// app/file99.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, /*    asset 99 line */
+0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x30, /*  0    var x0 = 0 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x39, 0x20, 0x6c, 0x69, /* ;    asset 99 li */
+0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, 0x20, 0x3d, /* ne 1    var x1 = */
+0x20, 0x39, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x39, 0x39, /*  99;    asset 99 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 2    var x */
+0x32, 0x20, 0x3d, 0x20, 0x31, 0x39, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, /* 2 = 198;    asse */
+0x74, 0x20, 0x39, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x2a, 0x2f, 0x20, 0x76, /* t 99 line 3    v */
+0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x32, 0x39, 0x37, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x3 = 297;     */
+// app/file100.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x30, 0x20, 0x6c, 0x69, 0x6e, /*    asset 100 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x30, 0x20, /* 0;    asset 100  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x30, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 100;    asset */
+0x20, 0x31, 0x30, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  100 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x30, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 200;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 100 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x30, 0x30, /*     var x3 = 300 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x30, 0x20, 0x6c, /* ;    asset 100 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x34, 0x30, 0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 400;           */
+// app/file101.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*    asset 101 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x31, 0x20, /* 0;    asset 101  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x30, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 101;    asset */
+0x20, 0x31, 0x30, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  101 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x30, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 202;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 101 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x30, 0x33, /*     var x3 = 303 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x31, 0x20, 0x6c, /* ;    asset 101 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x34, 0x30, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 404;    asset  */
+0x31, 0x30, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 101 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x35, 0x30, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, /* r x5 = 505;      */
+// app/file102.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x32, 0x20, 0x6c, 0x69, 0x6e, /*    asset 102 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x32, 0x20, /* 0;    asset 102  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x30, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 102;    asset */
+0x20, 0x31, 0x30, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  102 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x30, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 204;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 102 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x30, 0x36, /*     var x3 = 306 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x32, 0x20, 0x6c, /* ;    asset 102 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x34, 0x30, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 408;    asset  */
+0x31, 0x30, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 102 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x35, 0x31, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 510;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 102 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x36, 0x31, 0x32, 0x3b, /*    var x6 = 612; */
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*                  */
+// app/file103.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*    asset 103 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x33, 0x20, /* 0;    asset 103  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x30, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 103;    asset */
+0x20, 0x31, 0x30, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  103 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x30, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 206;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 103 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x30, 0x39, /*     var x3 = 309 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x33, 0x20, 0x6c, /* ;    asset 103 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x34, 0x31, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 412;    asset  */
+0x31, 0x30, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 103 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x35, 0x31, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 515;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 103 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x36, 0x31, 0x38, 0x3b, /*    var x6 = 618; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x33, 0x20, 0x6c, 0x69, /*     asset 103 li */
+0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x37, 0x20, 0x3d, /* ne 7    var x7 = */
+0x20, 0x37, 0x32, 0x31, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  721;            */
+// app/file104.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*    asset 104 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file105.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*    asset 105 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x35, 0x20, /* 0;    asset 105  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x30, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 105;          */
+// app/file106.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x36, 0x20, 0x6c, 0x69, 0x6e, /*    asset 106 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x36, 0x20, /* 0;    asset 106  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x30, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 106;    asset */
+0x20, 0x31, 0x30, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  106 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x31, 0x32, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 212;     */
+// app/file107.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*    asset 107 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x37, 0x20, /* 0;    asset 107  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x30, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 107;    asset */
+0x20, 0x31, 0x30, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  107 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x31, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 214;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 107 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x32, 0x31, /*     var x3 = 321 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file108.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x38, 0x20, 0x6c, 0x69, 0x6e, /*    asset 108 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x38, 0x20, /* 0;    asset 108  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x30, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 108;    asset */
+0x20, 0x31, 0x30, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  108 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x31, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 216;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 108 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x32, 0x34, /*     var x3 = 324 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x38, 0x20, 0x6c, /* ;    asset 108 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x34, 0x33, 0x32, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 432;           */
+// app/file109.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*    asset 109 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x39, 0x20, /* 0;    asset 109  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x30, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 109;    asset */
+0x20, 0x31, 0x30, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  109 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x31, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 218;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 109 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x32, 0x37, /*     var x3 = 327 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x30, 0x39, 0x20, 0x6c, /* ;    asset 109 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x34, 0x33, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 436;    asset  */
+0x31, 0x30, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 109 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x35, 0x34, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, /* r x5 = 545;      */
+// app/file110.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x30, 0x20, 0x6c, 0x69, 0x6e, /*    asset 110 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x30, 0x20, /* 0;    asset 110  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x31, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 110;    asset */
+0x20, 0x31, 0x31, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  110 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x32, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 220;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 110 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x33, 0x30, /*     var x3 = 330 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x30, 0x20, 0x6c, /* ;    asset 110 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x34, 0x34, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 440;    asset  */
+0x31, 0x31, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 110 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x35, 0x35, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 550;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 110 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x36, 0x36, 0x30, 0x3b, /*    var x6 = 660; */
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*                  */
+// app/file111.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*    asset 111 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x31, 0x20, /* 0;    asset 111  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x31, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 111;    asset */
+0x20, 0x31, 0x31, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  111 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x32, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 222;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 111 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x33, 0x33, /*     var x3 = 333 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x31, 0x20, 0x6c, /* ;    asset 111 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x34, 0x34, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 444;    asset  */
+0x31, 0x31, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 111 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x35, 0x35, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 555;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 111 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x36, 0x36, 0x36, 0x3b, /*    var x6 = 666; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x31, 0x20, 0x6c, 0x69, /*     asset 111 li */
+0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x37, 0x20, 0x3d, /* ne 7    var x7 = */
+0x20, 0x37, 0x37, 0x37, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  777;            */
+// app/file112.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x32, 0x20, 0x6c, 0x69, 0x6e, /*    asset 112 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file113.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*    asset 113 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x33, 0x20, /* 0;    asset 113  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x31, 0x33, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 113;          */
+// app/file114.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*    asset 114 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x34, 0x20, /* 0;    asset 114  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x31, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 114;    asset */
+0x20, 0x31, 0x31, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  114 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x32, 0x38, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 228;     */
+// app/file115.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*    asset 115 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x35, 0x20, /* 0;    asset 115  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x31, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 115;    asset */
+0x20, 0x31, 0x31, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  115 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x33, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 230;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 115 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x34, 0x35, /*     var x3 = 345 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file116.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x36, 0x20, 0x6c, 0x69, 0x6e, /*    asset 116 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x36, 0x20, /* 0;    asset 116  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x31, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 116;    asset */
+0x20, 0x31, 0x31, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  116 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x33, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 232;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 116 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x34, 0x38, /*     var x3 = 348 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x36, 0x20, 0x6c, /* ;    asset 116 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x34, 0x36, 0x34, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 464;           */
+// app/file117.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*    asset 117 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x37, 0x20, /* 0;    asset 117  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x31, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 117;    asset */
+0x20, 0x31, 0x31, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  117 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x33, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 234;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 117 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x35, 0x31, /*     var x3 = 351 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x37, 0x20, 0x6c, /* ;    asset 117 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x34, 0x36, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 468;    asset  */
+0x31, 0x31, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 117 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x35, 0x38, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, /* r x5 = 585;      */
+// app/file118.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x38, 0x20, 0x6c, 0x69, 0x6e, /*    asset 118 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x38, 0x20, /* 0;    asset 118  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x31, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 118;    asset */
+0x20, 0x31, 0x31, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  118 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x33, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 236;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 118 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x35, 0x34, /*     var x3 = 354 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x38, 0x20, 0x6c, /* ;    asset 118 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x34, 0x37, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 472;    asset  */
+0x31, 0x31, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 118 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x35, 0x39, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 590;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 118 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x37, 0x30, 0x38, 0x3b, /*    var x6 = 708; */
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*                  */
+// app/file119.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*    asset 119 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x39, 0x20, /* 0;    asset 119  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x31, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 119;    asset */
+0x20, 0x31, 0x31, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  119 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x33, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 238;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 119 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x35, 0x37, /*     var x3 = 357 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x39, 0x20, 0x6c, /* ;    asset 119 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x34, 0x37, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 476;    asset  */
+0x31, 0x31, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 119 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x35, 0x39, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 595;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 119 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x37, 0x31, 0x34, 0x3b, /*    var x6 = 714; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x31, 0x39, 0x20, 0x6c, 0x69, /*     asset 119 li */
+0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x37, 0x20, 0x3d, /* ne 7    var x7 = */
+0x20, 0x38, 0x33, 0x33, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  833;            */
+// app/file120.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x30, 0x20, 0x6c, 0x69, 0x6e, /*    asset 120 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file121.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*    asset 121 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x31, 0x20, /* 0;    asset 121  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x32, 0x31, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 121;          */
+// app/file122.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x32, 0x20, 0x6c, 0x69, 0x6e, /*    asset 122 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x32, 0x20, /* 0;    asset 122  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x32, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 122;    asset */
+0x20, 0x31, 0x32, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  122 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x34, 0x34, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 244;     */
+// app/file123.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*    asset 123 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x33, 0x20, /* 0;    asset 123  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x32, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 123;    asset */
+0x20, 0x31, 0x32, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  123 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x34, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 246;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 123 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x36, 0x39, /*     var x3 = 369 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file124.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*    asset 124 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x34, 0x20, /* 0;    asset 124  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x32, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 124;    asset */
+0x20, 0x31, 0x32, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  124 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x34, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 248;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 124 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x37, 0x32, /*     var x3 = 372 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x34, 0x20, 0x6c, /* ;    asset 124 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x34, 0x39, 0x36, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 496;           */
+// app/file125.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*    asset 125 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x35, 0x20, /* 0;    asset 125  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x32, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 125;    asset */
+0x20, 0x31, 0x32, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  125 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x35, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 250;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 125 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x37, 0x35, /*     var x3 = 375 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x35, 0x20, 0x6c, /* ;    asset 125 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x35, 0x30, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 500;    asset  */
+0x31, 0x32, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 125 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x36, 0x32, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, /* r x5 = 625;      */
+// app/file126.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x36, 0x20, 0x6c, 0x69, 0x6e, /*    asset 126 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x36, 0x20, /* 0;    asset 126  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x32, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 126;    asset */
+0x20, 0x31, 0x32, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  126 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x35, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 252;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 126 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x37, 0x38, /*     var x3 = 378 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x36, 0x20, 0x6c, /* ;    asset 126 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x35, 0x30, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 504;    asset  */
+0x31, 0x32, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 126 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x36, 0x33, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 630;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 126 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x37, 0x35, 0x36, 0x3b, /*    var x6 = 756; */
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*                  */
+// app/file127.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*    asset 127 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x37, 0x20, /* 0;    asset 127  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x32, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 127;    asset */
+0x20, 0x31, 0x32, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  127 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x35, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 254;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 127 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x38, 0x31, /*     var x3 = 381 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x37, 0x20, 0x6c, /* ;    asset 127 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x35, 0x30, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 508;    asset  */
+0x31, 0x32, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 127 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x36, 0x33, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 635;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 127 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x37, 0x36, 0x32, 0x3b, /*    var x6 = 762; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x37, 0x20, 0x6c, 0x69, /*     asset 127 li */
+0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x37, 0x20, 0x3d, /* ne 7    var x7 = */
+0x20, 0x38, 0x38, 0x39, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  889;            */
+// app/file128.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x38, 0x20, 0x6c, 0x69, 0x6e, /*    asset 128 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file129.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*    asset 129 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x32, 0x39, 0x20, /* 0;    asset 129  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x32, 0x39, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 129;          */
+// app/file130.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x30, 0x20, 0x6c, 0x69, 0x6e, /*    asset 130 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x30, 0x20, /* 0;    asset 130  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x33, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 130;    asset */
+0x20, 0x31, 0x33, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  130 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x36, 0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 260;     */
+// app/file131.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*    asset 131 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x31, 0x20, /* 0;    asset 131  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x33, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 131;    asset */
+0x20, 0x31, 0x33, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  131 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x36, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 262;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 131 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x39, 0x33, /*     var x3 = 393 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file132.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x32, 0x20, 0x6c, 0x69, 0x6e, /*    asset 132 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x32, 0x20, /* 0;    asset 132  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x33, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 132;    asset */
+0x20, 0x31, 0x33, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  132 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x36, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 264;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 132 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x39, 0x36, /*     var x3 = 396 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x32, 0x20, 0x6c, /* ;    asset 132 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x35, 0x32, 0x38, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 528;           */
+// app/file133.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*    asset 133 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x33, 0x20, /* 0;    asset 133  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x33, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 133;    asset */
+0x20, 0x31, 0x33, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  133 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x36, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 266;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 133 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x33, 0x39, 0x39, /*     var x3 = 399 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x33, 0x20, 0x6c, /* ;    asset 133 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x35, 0x33, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 532;    asset  */
+0x31, 0x33, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 133 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x36, 0x36, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, /* r x5 = 665;      */
+// app/file134.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*    asset 134 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x34, 0x20, /* 0;    asset 134  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x33, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 134;    asset */
+0x20, 0x31, 0x33, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  134 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x36, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 268;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 134 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x30, 0x32, /*     var x3 = 402 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x34, 0x20, 0x6c, /* ;    asset 134 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x35, 0x33, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 536;    asset  */
+0x31, 0x33, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 134 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x36, 0x37, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 670;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 134 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x38, 0x30, 0x34, 0x3b, /*    var x6 = 804; */
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*                  */
+// app/file135.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*    asset 135 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x35, 0x20, /* 0;    asset 135  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x33, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 135;    asset */
+0x20, 0x31, 0x33, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  135 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x37, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 270;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 135 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x30, 0x35, /*     var x3 = 405 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x35, 0x20, 0x6c, /* ;    asset 135 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x35, 0x34, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 540;    asset  */
+0x31, 0x33, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 135 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x36, 0x37, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 675;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 135 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x38, 0x31, 0x30, 0x3b, /*    var x6 = 810; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x35, 0x20, 0x6c, 0x69, /*     asset 135 li */
+0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x37, 0x20, 0x3d, /* ne 7    var x7 = */
+0x20, 0x39, 0x34, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  945;            */
+// app/file136.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x36, 0x20, 0x6c, 0x69, 0x6e, /*    asset 136 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file137.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*    asset 137 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x37, 0x20, /* 0;    asset 137  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x33, 0x37, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 137;          */
+// app/file138.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x38, 0x20, 0x6c, 0x69, 0x6e, /*    asset 138 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x38, 0x20, /* 0;    asset 138  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x33, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 138;    asset */
+0x20, 0x31, 0x33, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  138 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x37, 0x36, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 276;     */
+// app/file139.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*    asset 139 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x39, 0x20, /* 0;    asset 139  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x33, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 139;    asset */
+0x20, 0x31, 0x33, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  139 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x37, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 278;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x33, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 139 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x31, 0x37, /*     var x3 = 417 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file140.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x30, 0x20, 0x6c, 0x69, 0x6e, /*    asset 140 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x30, 0x20, /* 0;    asset 140  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x34, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 140;    asset */
+0x20, 0x31, 0x34, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  140 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x38, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 280;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 140 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x32, 0x30, /*     var x3 = 420 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x30, 0x20, 0x6c, /* ;    asset 140 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x35, 0x36, 0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 560;           */
+// app/file141.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*    asset 141 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x31, 0x20, /* 0;    asset 141  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x34, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 141;    asset */
+0x20, 0x31, 0x34, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  141 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x38, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 282;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 141 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x32, 0x33, /*     var x3 = 423 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x31, 0x20, 0x6c, /* ;    asset 141 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x35, 0x36, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 564;    asset  */
+0x31, 0x34, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 141 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x37, 0x30, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, /* r x5 = 705;      */
+// app/file142.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x32, 0x20, 0x6c, 0x69, 0x6e, /*    asset 142 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x32, 0x20, /* 0;    asset 142  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x34, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 142;    asset */
+0x20, 0x31, 0x34, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  142 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x38, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 284;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 142 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x32, 0x36, /*     var x3 = 426 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x32, 0x20, 0x6c, /* ;    asset 142 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x35, 0x36, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 568;    asset  */
+0x31, 0x34, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 142 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x37, 0x31, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 710;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 142 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x38, 0x35, 0x32, 0x3b, /*    var x6 = 852; */
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*                  */
+// app/file143.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*    asset 143 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x33, 0x20, /* 0;    asset 143  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x34, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 143;    asset */
+0x20, 0x31, 0x34, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  143 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x38, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 286;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 143 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x32, 0x39, /*     var x3 = 429 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x33, 0x20, 0x6c, /* ;    asset 143 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x35, 0x37, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 572;    asset  */
+0x31, 0x34, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 143 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x37, 0x31, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 715;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 143 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x38, 0x35, 0x38, 0x3b, /*    var x6 = 858; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x33, 0x20, 0x6c, 0x69, /*     asset 143 li */
+0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x37, 0x20, 0x3d, /* ne 7    var x7 = */
+0x20, 0x31, 0x30, 0x30, 0x31, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  1001;           */
+// app/file144.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*    asset 144 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file145.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*    asset 145 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x35, 0x20, /* 0;    asset 145  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x34, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 145;          */
+// app/file146.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x36, 0x20, 0x6c, 0x69, 0x6e, /*    asset 146 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x36, 0x20, /* 0;    asset 146  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x34, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 146;    asset */
+0x20, 0x31, 0x34, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  146 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x39, 0x32, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 292;     */
+// app/file147.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*    asset 147 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x37, 0x20, /* 0;    asset 147  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x34, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 147;    asset */
+0x20, 0x31, 0x34, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  147 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x39, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 294;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 147 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x34, 0x31, /*     var x3 = 441 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file148.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x38, 0x20, 0x6c, 0x69, 0x6e, /*    asset 148 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x38, 0x20, /* 0;    asset 148  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x34, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 148;    asset */
+0x20, 0x31, 0x34, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  148 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x39, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 296;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 148 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x34, 0x34, /*     var x3 = 444 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x38, 0x20, 0x6c, /* ;    asset 148 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x35, 0x39, 0x32, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 592;           */
+// app/file149.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*    asset 149 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x39, 0x20, /* 0;    asset 149  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x34, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 149;    asset */
+0x20, 0x31, 0x34, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  149 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x32, 0x39, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 298;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 149 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x34, 0x37, /*     var x3 = 447 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x34, 0x39, 0x20, 0x6c, /* ;    asset 149 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x35, 0x39, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 596;    asset  */
+0x31, 0x34, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 149 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x37, 0x34, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, /* r x5 = 745;      */
+// app/file150.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x30, 0x20, 0x6c, 0x69, 0x6e, /*    asset 150 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x30, 0x20, /* 0;    asset 150  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x35, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 150;    asset */
+0x20, 0x31, 0x35, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  150 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x30, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 300;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 150 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x35, 0x30, /*     var x3 = 450 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x30, 0x20, 0x6c, /* ;    asset 150 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x36, 0x30, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 600;    asset  */
+0x31, 0x35, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 150 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x37, 0x35, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 750;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 150 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x39, 0x30, 0x30, 0x3b, /*    var x6 = 900; */
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*                  */
+// app/file151.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*    asset 151 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x31, 0x20, /* 0;    asset 151  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x35, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 151;    asset */
+0x20, 0x31, 0x35, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  151 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x30, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 302;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 151 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x35, 0x33, /*     var x3 = 453 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x31, 0x20, 0x6c, /* ;    asset 151 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x36, 0x30, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 604;    asset  */
+0x31, 0x35, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 151 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x37, 0x35, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 755;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 151 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x39, 0x30, 0x36, 0x3b, /*    var x6 = 906; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x31, 0x20, 0x6c, 0x69, /*     asset 151 li */
+0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x37, 0x20, 0x3d, /* ne 7    var x7 = */
+0x20, 0x31, 0x30, 0x35, 0x37, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  1057;           */
+// app/file152.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x32, 0x20, 0x6c, 0x69, 0x6e, /*    asset 152 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file153.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*    asset 153 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x33, 0x20, /* 0;    asset 153  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x35, 0x33, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 153;          */
+// app/file154.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*    asset 154 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x34, 0x20, /* 0;    asset 154  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x35, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 154;    asset */
+0x20, 0x31, 0x35, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  154 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x30, 0x38, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 308;     */
+// app/file155.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*    asset 155 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x35, 0x20, /* 0;    asset 155  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x35, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 155;    asset */
+0x20, 0x31, 0x35, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  155 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x31, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 310;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 155 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x36, 0x35, /*     var x3 = 465 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file156.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x36, 0x20, 0x6c, 0x69, 0x6e, /*    asset 156 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x36, 0x20, /* 0;    asset 156  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x35, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 156;    asset */
+0x20, 0x31, 0x35, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  156 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x31, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 312;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 156 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x36, 0x38, /*     var x3 = 468 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x36, 0x20, 0x6c, /* ;    asset 156 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x36, 0x32, 0x34, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 624;           */
+// app/file157.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*    asset 157 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x37, 0x20, /* 0;    asset 157  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x35, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 157;    asset */
+0x20, 0x31, 0x35, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  157 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x31, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 314;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 157 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x37, 0x31, /*     var x3 = 471 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x37, 0x20, 0x6c, /* ;    asset 157 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x36, 0x32, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 628;    asset  */
+0x31, 0x35, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 157 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x37, 0x38, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, /* r x5 = 785;      */
+// app/file158.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x38, 0x20, 0x6c, 0x69, 0x6e, /*    asset 158 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x38, 0x20, /* 0;    asset 158  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x35, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 158;    asset */
+0x20, 0x31, 0x35, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  158 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x31, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 316;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 158 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x37, 0x34, /*     var x3 = 474 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x38, 0x20, 0x6c, /* ;    asset 158 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x36, 0x33, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 632;    asset  */
+0x31, 0x35, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 158 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x37, 0x39, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 790;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 158 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x39, 0x34, 0x38, 0x3b, /*    var x6 = 948; */
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*                  */
+// app/file159.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*    asset 159 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x39, 0x20, /* 0;    asset 159  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x35, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 159;    asset */
+0x20, 0x31, 0x35, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  159 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x31, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 318;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 159 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x37, 0x37, /*     var x3 = 477 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x39, 0x20, 0x6c, /* ;    asset 159 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x36, 0x33, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 636;    asset  */
+0x31, 0x35, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 159 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x37, 0x39, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 795;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 159 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x39, 0x35, 0x34, 0x3b, /*    var x6 = 954; */
+0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x35, 0x39, 0x20, 0x6c, 0x69, /*     asset 159 li */
+0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x37, 0x20, 0x3d, /* ne 7    var x7 = */
+0x20, 0x31, 0x31, 0x31, 0x33, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  1113;           */
+// app/file160.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x30, 0x20, 0x6c, 0x69, 0x6e, /*    asset 160 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file161.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*    asset 161 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x31, 0x20, /* 0;    asset 161  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x36, 0x31, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 161;          */
+// app/file162.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x32, 0x20, 0x6c, 0x69, 0x6e, /*    asset 162 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x32, 0x20, /* 0;    asset 162  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x36, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 162;    asset */
+0x20, 0x31, 0x36, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  162 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x32, 0x34, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 324;     */
+// app/file163.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*    asset 163 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x33, 0x20, /* 0;    asset 163  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x36, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 163;    asset */
+0x20, 0x31, 0x36, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  163 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x32, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 326;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 163 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x38, 0x39, /*     var x3 = 489 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file164.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*    asset 164 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x34, 0x20, /* 0;    asset 164  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x36, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 164;    asset */
+0x20, 0x31, 0x36, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  164 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x32, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 328;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 164 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x39, 0x32, /*     var x3 = 492 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x34, 0x20, 0x6c, /* ;    asset 164 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x36, 0x35, 0x36, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 656;           */
+// app/file165.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*    asset 165 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x35, 0x20, /* 0;    asset 165  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x36, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 165;    asset */
+0x20, 0x31, 0x36, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  165 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x33, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 330;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 165 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x39, 0x35, /*     var x3 = 495 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x35, 0x20, 0x6c, /* ;    asset 165 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x36, 0x36, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 660;    asset  */
+0x31, 0x36, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 165 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x38, 0x32, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, /* r x5 = 825;      */
+// app/file166.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x36, 0x20, 0x6c, 0x69, 0x6e, /*    asset 166 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x36, 0x20, /* 0;    asset 166  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x36, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 166;    asset */
+0x20, 0x31, 0x36, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  166 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x33, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 332;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 166 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x34, 0x39, 0x38, /*     var x3 = 498 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x36, 0x20, 0x6c, /* ;    asset 166 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x36, 0x36, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 664;    asset  */
+0x31, 0x36, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 166 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x38, 0x33, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 830;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 166 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x39, 0x39, 0x36, 0x3b, /*    var x6 = 996; */
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*                  */
+// app/file167.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*    asset 167 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x37, 0x20, /* 0;    asset 167  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x36, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 167;    asset */
+0x20, 0x31, 0x36, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  167 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x33, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 334;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 167 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x30, 0x31, /*     var x3 = 501 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x37, 0x20, 0x6c, /* ;    asset 167 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x36, 0x36, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 668;    asset  */
+0x31, 0x36, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 167 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x38, 0x33, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 835;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 167 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x30, 0x32, /*    var x6 = 1002 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x37, 0x20, 0x6c, /* ;    asset 167 l */
+0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x37, 0x20, /* ine 7    var x7  */
+0x3d, 0x20, 0x31, 0x31, 0x36, 0x39, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 1169;          */
+// app/file168.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x38, 0x20, 0x6c, 0x69, 0x6e, /*    asset 168 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file169.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*    asset 169 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x36, 0x39, 0x20, /* 0;    asset 169  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x36, 0x39, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 169;          */
+// app/file170.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x30, 0x20, 0x6c, 0x69, 0x6e, /*    asset 170 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x30, 0x20, /* 0;    asset 170  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x37, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 170;    asset */
+0x20, 0x31, 0x37, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  170 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x34, 0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 340;     */
+// app/file171.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*    asset 171 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x31, 0x20, /* 0;    asset 171  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x37, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 171;    asset */
+0x20, 0x31, 0x37, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  171 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x34, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 342;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 171 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x31, 0x33, /*     var x3 = 513 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file172.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x32, 0x20, 0x6c, 0x69, 0x6e, /*    asset 172 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x32, 0x20, /* 0;    asset 172  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x37, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 172;    asset */
+0x20, 0x31, 0x37, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  172 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x34, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 344;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 172 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x31, 0x36, /*     var x3 = 516 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x32, 0x20, 0x6c, /* ;    asset 172 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x36, 0x38, 0x38, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 688;           */
+// app/file173.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*    asset 173 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x33, 0x20, /* 0;    asset 173  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x37, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 173;    asset */
+0x20, 0x31, 0x37, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  173 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x34, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 346;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 173 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x31, 0x39, /*     var x3 = 519 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x33, 0x20, 0x6c, /* ;    asset 173 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x36, 0x39, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 692;    asset  */
+0x31, 0x37, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 173 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x38, 0x36, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, /* r x5 = 865;      */
+// app/file174.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*    asset 174 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x34, 0x20, /* 0;    asset 174  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x37, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 174;    asset */
+0x20, 0x31, 0x37, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  174 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x34, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 348;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 174 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x32, 0x32, /*     var x3 = 522 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x34, 0x20, 0x6c, /* ;    asset 174 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x36, 0x39, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 696;    asset  */
+0x31, 0x37, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 174 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x38, 0x37, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 870;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 174 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x34, 0x34, /*    var x6 = 1044 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file175.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*    asset 175 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x35, 0x20, /* 0;    asset 175  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x37, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 175;    asset */
+0x20, 0x31, 0x37, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  175 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x35, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 350;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 175 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x32, 0x35, /*     var x3 = 525 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x35, 0x20, 0x6c, /* ;    asset 175 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x37, 0x30, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 700;    asset  */
+0x31, 0x37, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 175 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x38, 0x37, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 875;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 175 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x35, 0x30, /*    var x6 = 1050 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x35, 0x20, 0x6c, /* ;    asset 175 l */
+0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x37, 0x20, /* ine 7    var x7  */
+0x3d, 0x20, 0x31, 0x32, 0x32, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 1225;          */
+// app/file176.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x36, 0x20, 0x6c, 0x69, 0x6e, /*    asset 176 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file177.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*    asset 177 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x37, 0x20, /* 0;    asset 177  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x37, 0x37, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 177;          */
+// app/file178.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x38, 0x20, 0x6c, 0x69, 0x6e, /*    asset 178 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x38, 0x20, /* 0;    asset 178  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x37, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 178;    asset */
+0x20, 0x31, 0x37, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  178 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x35, 0x36, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 356;     */
+// app/file179.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*    asset 179 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x39, 0x20, /* 0;    asset 179  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x37, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 179;    asset */
+0x20, 0x31, 0x37, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  179 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x35, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 358;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x37, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 179 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x33, 0x37, /*     var x3 = 537 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file180.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x30, 0x20, 0x6c, 0x69, 0x6e, /*    asset 180 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x30, 0x20, /* 0;    asset 180  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x38, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 180;    asset */
+0x20, 0x31, 0x38, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  180 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x36, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 360;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 180 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x34, 0x30, /*     var x3 = 540 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x30, 0x20, 0x6c, /* ;    asset 180 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x37, 0x32, 0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 720;           */
+// app/file181.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*    asset 181 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x31, 0x20, /* 0;    asset 181  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x38, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 181;    asset */
+0x20, 0x31, 0x38, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  181 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x36, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 362;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 181 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x34, 0x33, /*     var x3 = 543 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x31, 0x20, 0x6c, /* ;    asset 181 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x37, 0x32, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 724;    asset  */
+0x31, 0x38, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 181 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x39, 0x30, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, /* r x5 = 905;      */
+// app/file182.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x32, 0x20, 0x6c, 0x69, 0x6e, /*    asset 182 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x32, 0x20, /* 0;    asset 182  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x38, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 182;    asset */
+0x20, 0x31, 0x38, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  182 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x36, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 364;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 182 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x34, 0x36, /*     var x3 = 546 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x32, 0x20, 0x6c, /* ;    asset 182 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x37, 0x32, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 728;    asset  */
+0x31, 0x38, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 182 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x39, 0x31, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 910;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 182 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x39, 0x32, /*    var x6 = 1092 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file183.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*    asset 183 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x33, 0x20, /* 0;    asset 183  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x38, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 183;    asset */
+0x20, 0x31, 0x38, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  183 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x36, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 366;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 183 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x34, 0x39, /*     var x3 = 549 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x33, 0x20, 0x6c, /* ;    asset 183 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x37, 0x33, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 732;    asset  */
+0x31, 0x38, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 183 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x39, 0x31, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 915;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 183 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x39, 0x38, /*    var x6 = 1098 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x33, 0x20, 0x6c, /* ;    asset 183 l */
+0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x37, 0x20, /* ine 7    var x7  */
+0x3d, 0x20, 0x31, 0x32, 0x38, 0x31, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 1281;          */
+// app/file184.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*    asset 184 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file185.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*    asset 185 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x35, 0x20, /* 0;    asset 185  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x38, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 185;          */
+// app/file186.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x36, 0x20, 0x6c, 0x69, 0x6e, /*    asset 186 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x36, 0x20, /* 0;    asset 186  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x38, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 186;    asset */
+0x20, 0x31, 0x38, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  186 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x37, 0x32, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 372;     */
+// app/file187.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*    asset 187 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x37, 0x20, /* 0;    asset 187  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x38, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 187;    asset */
+0x20, 0x31, 0x38, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  187 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x37, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 374;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 187 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x36, 0x31, /*     var x3 = 561 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file188.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x38, 0x20, 0x6c, 0x69, 0x6e, /*    asset 188 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x38, 0x20, /* 0;    asset 188  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x38, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 188;    asset */
+0x20, 0x31, 0x38, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  188 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x37, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 376;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 188 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x36, 0x34, /*     var x3 = 564 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x38, 0x20, 0x6c, /* ;    asset 188 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x37, 0x35, 0x32, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 752;           */
+// app/file189.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*    asset 189 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x39, 0x20, /* 0;    asset 189  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x38, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 189;    asset */
+0x20, 0x31, 0x38, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  189 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x37, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 378;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 189 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x36, 0x37, /*     var x3 = 567 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x38, 0x39, 0x20, 0x6c, /* ;    asset 189 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x37, 0x35, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 756;    asset  */
+0x31, 0x38, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 189 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x39, 0x34, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, /* r x5 = 945;      */
+// app/file190.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x30, 0x20, 0x6c, 0x69, 0x6e, /*    asset 190 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x30, 0x20, /* 0;    asset 190  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x39, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 190;    asset */
+0x20, 0x31, 0x39, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  190 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x38, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 380;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 190 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x37, 0x30, /*     var x3 = 570 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x30, 0x20, 0x6c, /* ;    asset 190 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x37, 0x36, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 760;    asset  */
+0x31, 0x39, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 190 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x39, 0x35, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 950;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 190 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x34, 0x30, /*    var x6 = 1140 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file191.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*    asset 191 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x31, 0x20, /* 0;    asset 191  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x39, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 191;    asset */
+0x20, 0x31, 0x39, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  191 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x38, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 382;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 191 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x37, 0x33, /*     var x3 = 573 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x31, 0x20, 0x6c, /* ;    asset 191 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x37, 0x36, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 764;    asset  */
+0x31, 0x39, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 191 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x39, 0x35, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 955;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 191 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x34, 0x36, /*    var x6 = 1146 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x31, 0x20, 0x6c, /* ;    asset 191 l */
+0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x37, 0x20, /* ine 7    var x7  */
+0x3d, 0x20, 0x31, 0x33, 0x33, 0x37, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 1337;          */
+// app/file192.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x32, 0x20, 0x6c, 0x69, 0x6e, /*    asset 192 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file193.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*    asset 193 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x33, 0x20, /* 0;    asset 193  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x39, 0x33, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 193;          */
+// app/file194.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*    asset 194 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x34, 0x20, /* 0;    asset 194  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x39, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 194;    asset */
+0x20, 0x31, 0x39, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  194 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x38, 0x38, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 388;     */
+// app/file195.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*    asset 195 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x35, 0x20, /* 0;    asset 195  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x39, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 195;    asset */
+0x20, 0x31, 0x39, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  195 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x39, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 390;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 195 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x38, 0x35, /*     var x3 = 585 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file196.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x36, 0x20, 0x6c, 0x69, 0x6e, /*    asset 196 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x36, 0x20, /* 0;    asset 196  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x39, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 196;    asset */
+0x20, 0x31, 0x39, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  196 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x39, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 392;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 196 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x38, 0x38, /*     var x3 = 588 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x36, 0x20, 0x6c, /* ;    asset 196 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x37, 0x38, 0x34, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 784;           */
+// app/file197.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*    asset 197 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x37, 0x20, /* 0;    asset 197  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x39, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 197;    asset */
+0x20, 0x31, 0x39, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  197 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x39, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 394;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 197 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x39, 0x31, /*     var x3 = 591 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x37, 0x20, 0x6c, /* ;    asset 197 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x37, 0x38, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 788;    asset  */
+0x31, 0x39, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 197 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x39, 0x38, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, /* r x5 = 985;      */
+// app/file198.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x38, 0x20, 0x6c, 0x69, 0x6e, /*    asset 198 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x38, 0x20, /* 0;    asset 198  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x39, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 198;    asset */
+0x20, 0x31, 0x39, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  198 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x39, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 396;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 198 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x39, 0x34, /*     var x3 = 594 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x38, 0x20, 0x6c, /* ;    asset 198 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x37, 0x39, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 792;    asset  */
+0x31, 0x39, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 198 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x39, 0x39, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 990;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 198 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x38, 0x38, /*    var x6 = 1188 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file199.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*    asset 199 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x39, 0x20, /* 0;    asset 199  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x31, 0x39, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 199;    asset */
+0x20, 0x31, 0x39, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  199 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x33, 0x39, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 398;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 199 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x35, 0x39, 0x37, /*     var x3 = 597 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x39, 0x20, 0x6c, /* ;    asset 199 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x37, 0x39, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 796;    asset  */
+0x31, 0x39, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 199 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x39, 0x39, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, /* r x5 = 995;    a */
+0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x20, /* sset 199 line 6  */
+0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x39, 0x34, /*    var x6 = 1194 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x31, 0x39, 0x39, 0x20, 0x6c, /* ;    asset 199 l */
+0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x37, 0x20, /* ine 7    var x7  */
+0x3d, 0x20, 0x31, 0x33, 0x39, 0x33, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 1393;          */
+// app/file200.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x30, 0x20, 0x6c, 0x69, 0x6e, /*    asset 200 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file201.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*    asset 201 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x31, 0x20, /* 0;    asset 201  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x30, 0x31, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 201;          */
+// app/file202.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x32, 0x20, 0x6c, 0x69, 0x6e, /*    asset 202 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x32, 0x20, /* 0;    asset 202  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x30, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 202;    asset */
+0x20, 0x32, 0x30, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  202 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x30, 0x34, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 404;     */
+// app/file203.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*    asset 203 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x33, 0x20, /* 0;    asset 203  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x30, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 203;    asset */
+0x20, 0x32, 0x30, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  203 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x30, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 406;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 203 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x30, 0x39, /*     var x3 = 609 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file204.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*    asset 204 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x34, 0x20, /* 0;    asset 204  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x30, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 204;    asset */
+0x20, 0x32, 0x30, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  204 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x30, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 408;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 204 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x31, 0x32, /*     var x3 = 612 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x34, 0x20, 0x6c, /* ;    asset 204 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x38, 0x31, 0x36, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 816;           */
+// app/file205.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*    asset 205 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x35, 0x20, /* 0;    asset 205  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x30, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 205;    asset */
+0x20, 0x32, 0x30, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  205 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x31, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 410;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 205 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x31, 0x35, /*     var x3 = 615 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x35, 0x20, 0x6c, /* ;    asset 205 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x38, 0x32, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 820;    asset  */
+0x32, 0x30, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 205 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x32, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* r x5 = 1025;     */
+// app/file206.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x36, 0x20, 0x6c, 0x69, 0x6e, /*    asset 206 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x36, 0x20, /* 0;    asset 206  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x30, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 206;    asset */
+0x20, 0x32, 0x30, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  206 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x31, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 412;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 206 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x31, 0x38, /*     var x3 = 618 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x36, 0x20, 0x6c, /* ;    asset 206 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x38, 0x32, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 824;    asset  */
+0x32, 0x30, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 206 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x33, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* r x5 = 1030;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, /* asset 206 line 6 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x33, /*     var x6 = 123 */
+0x36, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 6;               */
+// app/file207.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*    asset 207 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x37, 0x20, /* 0;    asset 207  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x30, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 207;    asset */
+0x20, 0x32, 0x30, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  207 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x31, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 414;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 207 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x32, 0x31, /*     var x3 = 621 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x37, 0x20, 0x6c, /* ;    asset 207 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x38, 0x32, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 828;    asset  */
+0x32, 0x30, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 207 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x33, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* r x5 = 1035;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, /* asset 207 line 6 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x34, /*     var x6 = 124 */
+0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x37, 0x20, /* 2;    asset 207  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x37, /* line 7    var x7 */
+0x20, 0x3d, 0x20, 0x31, 0x34, 0x34, 0x39, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 1449;         */
+// app/file208.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x38, 0x20, 0x6c, 0x69, 0x6e, /*    asset 208 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file209.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*    asset 209 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x30, 0x39, 0x20, /* 0;    asset 209  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x30, 0x39, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 209;          */
+// app/file210.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x30, 0x20, 0x6c, 0x69, 0x6e, /*    asset 210 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x30, 0x20, /* 0;    asset 210  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x31, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 210;    asset */
+0x20, 0x32, 0x31, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  210 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x32, 0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 420;     */
+// app/file211.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*    asset 211 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x31, 0x20, /* 0;    asset 211  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x31, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 211;    asset */
+0x20, 0x32, 0x31, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  211 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x32, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 422;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 211 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x33, 0x33, /*     var x3 = 633 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file212.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x32, 0x20, 0x6c, 0x69, 0x6e, /*    asset 212 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x32, 0x20, /* 0;    asset 212  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x31, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 212;    asset */
+0x20, 0x32, 0x31, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  212 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x32, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 424;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 212 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x33, 0x36, /*     var x3 = 636 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x32, 0x20, 0x6c, /* ;    asset 212 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x38, 0x34, 0x38, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 848;           */
+// app/file213.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*    asset 213 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x33, 0x20, /* 0;    asset 213  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x31, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 213;    asset */
+0x20, 0x32, 0x31, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  213 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x32, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 426;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 213 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x33, 0x39, /*     var x3 = 639 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x33, 0x20, 0x6c, /* ;    asset 213 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x38, 0x35, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 852;    asset  */
+0x32, 0x31, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 213 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x36, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* r x5 = 1065;     */
+// app/file214.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*    asset 214 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x34, 0x20, /* 0;    asset 214  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x31, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 214;    asset */
+0x20, 0x32, 0x31, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  214 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x32, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 428;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 214 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x34, 0x32, /*     var x3 = 642 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x34, 0x20, 0x6c, /* ;    asset 214 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x38, 0x35, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 856;    asset  */
+0x32, 0x31, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 214 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x37, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* r x5 = 1070;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, /* asset 214 line 6 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x38, /*     var x6 = 128 */
+0x34, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 4;               */
+// app/file215.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*    asset 215 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x35, 0x20, /* 0;    asset 215  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x31, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 215;    asset */
+0x20, 0x32, 0x31, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  215 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x33, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 430;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 215 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x34, 0x35, /*     var x3 = 645 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x35, 0x20, 0x6c, /* ;    asset 215 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x38, 0x36, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 860;    asset  */
+0x32, 0x31, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 215 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x37, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* r x5 = 1075;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, /* asset 215 line 6 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x39, /*     var x6 = 129 */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x35, 0x20, /* 0;    asset 215  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x37, /* line 7    var x7 */
+0x20, 0x3d, 0x20, 0x31, 0x35, 0x30, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 1505;         */
+// app/file216.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x36, 0x20, 0x6c, 0x69, 0x6e, /*    asset 216 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file217.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*    asset 217 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x37, 0x20, /* 0;    asset 217  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x31, 0x37, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 217;          */
+// app/file218.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x38, 0x20, 0x6c, 0x69, 0x6e, /*    asset 218 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x38, 0x20, /* 0;    asset 218  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x31, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 218;    asset */
+0x20, 0x32, 0x31, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  218 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x33, 0x36, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 436;     */
+// app/file219.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*    asset 219 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x39, 0x20, /* 0;    asset 219  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x31, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 219;    asset */
+0x20, 0x32, 0x31, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  219 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x33, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 438;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x31, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 219 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x35, 0x37, /*     var x3 = 657 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file220.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x30, 0x20, 0x6c, 0x69, 0x6e, /*    asset 220 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x30, 0x20, /* 0;    asset 220  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x32, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 220;    asset */
+0x20, 0x32, 0x32, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  220 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x34, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 440;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 220 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x36, 0x30, /*     var x3 = 660 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x30, 0x20, 0x6c, /* ;    asset 220 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x38, 0x38, 0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 880;           */
+// app/file221.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*    asset 221 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x31, 0x20, /* 0;    asset 221  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x32, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 221;    asset */
+0x20, 0x32, 0x32, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  221 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x34, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 442;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 221 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x36, 0x33, /*     var x3 = 663 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x31, 0x20, 0x6c, /* ;    asset 221 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x38, 0x38, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 884;    asset  */
+0x32, 0x32, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 221 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x30, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* r x5 = 1105;     */
+// app/file222.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x32, 0x20, 0x6c, 0x69, 0x6e, /*    asset 222 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x32, 0x20, /* 0;    asset 222  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x32, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 222;    asset */
+0x20, 0x32, 0x32, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  222 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x34, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 444;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 222 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x36, 0x36, /*     var x3 = 666 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x32, 0x20, 0x6c, /* ;    asset 222 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x38, 0x38, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 888;    asset  */
+0x32, 0x32, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 222 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x31, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* r x5 = 1110;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, /* asset 222 line 6 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x33, 0x33, /*     var x6 = 133 */
+0x32, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 2;               */
+// app/file223.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*    asset 223 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x33, 0x20, /* 0;    asset 223  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x32, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 223;    asset */
+0x20, 0x32, 0x32, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  223 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x34, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 446;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 223 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x36, 0x39, /*     var x3 = 669 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x33, 0x20, 0x6c, /* ;    asset 223 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x38, 0x39, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 892;    asset  */
+0x32, 0x32, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 223 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x31, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* r x5 = 1115;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, /* asset 223 line 6 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x33, 0x33, /*     var x6 = 133 */
+0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x33, 0x20, /* 8;    asset 223  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x37, /* line 7    var x7 */
+0x20, 0x3d, 0x20, 0x31, 0x35, 0x36, 0x31, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 1561;         */
+// app/file224.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*    asset 224 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file225.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*    asset 225 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x35, 0x20, /* 0;    asset 225  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x32, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 225;          */
+// app/file226.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x36, 0x20, 0x6c, 0x69, 0x6e, /*    asset 226 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x36, 0x20, /* 0;    asset 226  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x32, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 226;    asset */
+0x20, 0x32, 0x32, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  226 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x35, 0x32, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 452;     */
+// app/file227.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*    asset 227 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x37, 0x20, /* 0;    asset 227  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x32, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 227;    asset */
+0x20, 0x32, 0x32, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  227 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x35, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 454;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 227 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x38, 0x31, /*     var x3 = 681 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file228.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x38, 0x20, 0x6c, 0x69, 0x6e, /*    asset 228 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x38, 0x20, /* 0;    asset 228  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x32, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 228;    asset */
+0x20, 0x32, 0x32, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  228 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x35, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 456;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 228 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x38, 0x34, /*     var x3 = 684 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x38, 0x20, 0x6c, /* ;    asset 228 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x39, 0x31, 0x32, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 912;           */
+// app/file229.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*    asset 229 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x39, 0x20, /* 0;    asset 229  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x32, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 229;    asset */
+0x20, 0x32, 0x32, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  229 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x35, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 458;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 229 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x38, 0x37, /*     var x3 = 687 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x32, 0x39, 0x20, 0x6c, /* ;    asset 229 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x39, 0x31, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 916;    asset  */
+0x32, 0x32, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 229 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x34, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* r x5 = 1145;     */
+// app/file230.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x30, 0x20, 0x6c, 0x69, 0x6e, /*    asset 230 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x30, 0x20, /* 0;    asset 230  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x33, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 230;    asset */
+0x20, 0x32, 0x33, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  230 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x36, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 460;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 230 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x39, 0x30, /*     var x3 = 690 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x30, 0x20, 0x6c, /* ;    asset 230 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x39, 0x32, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 920;    asset  */
+0x32, 0x33, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 230 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x35, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* r x5 = 1150;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, /* asset 230 line 6 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x33, 0x38, /*     var x6 = 138 */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file231.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*    asset 231 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x31, 0x20, /* 0;    asset 231  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x33, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 231;    asset */
+0x20, 0x32, 0x33, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  231 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x36, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 462;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 231 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x36, 0x39, 0x33, /*     var x3 = 693 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x31, 0x20, 0x6c, /* ;    asset 231 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x39, 0x32, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 924;    asset  */
+0x32, 0x33, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 231 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x35, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* r x5 = 1155;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, /* asset 231 line 6 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x33, 0x38, /*     var x6 = 138 */
+0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x31, 0x20, /* 6;    asset 231  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x37, /* line 7    var x7 */
+0x20, 0x3d, 0x20, 0x31, 0x36, 0x31, 0x37, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 1617;         */
+// app/file232.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x32, 0x20, 0x6c, 0x69, 0x6e, /*    asset 232 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file233.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*    asset 233 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x33, 0x20, /* 0;    asset 233  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x33, 0x33, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 233;          */
+// app/file234.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*    asset 234 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x34, 0x20, /* 0;    asset 234  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x33, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 234;    asset */
+0x20, 0x32, 0x33, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  234 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x36, 0x38, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 468;     */
+// app/file235.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*    asset 235 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x35, 0x20, /* 0;    asset 235  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x33, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 235;    asset */
+0x20, 0x32, 0x33, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  235 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x37, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 470;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 235 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x37, 0x30, 0x35, /*     var x3 = 705 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file236.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x36, 0x20, 0x6c, 0x69, 0x6e, /*    asset 236 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x36, 0x20, /* 0;    asset 236  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x33, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 236;    asset */
+0x20, 0x32, 0x33, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  236 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x37, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 472;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 236 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x37, 0x30, 0x38, /*     var x3 = 708 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x36, 0x20, 0x6c, /* ;    asset 236 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x39, 0x34, 0x34, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 944;           */
+// app/file237.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*    asset 237 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x37, 0x20, /* 0;    asset 237  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x33, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 237;    asset */
+0x20, 0x32, 0x33, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  237 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x37, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 474;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 237 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x37, 0x31, 0x31, /*     var x3 = 711 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x37, 0x20, 0x6c, /* ;    asset 237 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x39, 0x34, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 948;    asset  */
+0x32, 0x33, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 237 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x38, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* r x5 = 1185;     */
+// app/file238.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x38, 0x20, 0x6c, 0x69, 0x6e, /*    asset 238 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x38, 0x20, /* 0;    asset 238  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x33, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 238;    asset */
+0x20, 0x32, 0x33, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  238 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x37, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 476;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 238 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x37, 0x31, 0x34, /*     var x3 = 714 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x38, 0x20, 0x6c, /* ;    asset 238 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x39, 0x35, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 952;    asset  */
+0x32, 0x33, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 238 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x39, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* r x5 = 1190;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, /* asset 238 line 6 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x34, 0x32, /*     var x6 = 142 */
+0x38, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 8;               */
+// app/file239.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*    asset 239 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x39, 0x20, /* 0;    asset 239  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x33, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 239;    asset */
+0x20, 0x32, 0x33, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  239 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x37, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 478;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 239 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x37, 0x31, 0x37, /*     var x3 = 717 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x39, 0x20, 0x6c, /* ;    asset 239 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x39, 0x35, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 956;    asset  */
+0x32, 0x33, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 239 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x31, 0x39, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* r x5 = 1195;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, /* asset 239 line 6 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x34, 0x33, /*     var x6 = 143 */
+0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x33, 0x39, 0x20, /* 4;    asset 239  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x37, /* line 7    var x7 */
+0x20, 0x3d, 0x20, 0x31, 0x36, 0x37, 0x33, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 1673;         */
+// app/file240.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x30, 0x20, 0x6c, 0x69, 0x6e, /*    asset 240 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file241.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*    asset 241 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x31, 0x20, /* 0;    asset 241  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x34, 0x31, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 241;          */
+// app/file242.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x32, 0x20, 0x6c, 0x69, 0x6e, /*    asset 242 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x32, 0x20, /* 0;    asset 242  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x34, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 242;    asset */
+0x20, 0x32, 0x34, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  242 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x38, 0x34, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 484;     */
+// app/file243.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*    asset 243 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x33, 0x20, /* 0;    asset 243  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x34, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 243;    asset */
+0x20, 0x32, 0x34, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  243 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x38, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 486;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 243 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x37, 0x32, 0x39, /*     var x3 = 729 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file244.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*    asset 244 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x34, 0x20, /* 0;    asset 244  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x34, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 244;    asset */
+0x20, 0x32, 0x34, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  244 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x38, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 488;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 244 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x37, 0x33, 0x32, /*     var x3 = 732 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x34, 0x20, 0x6c, /* ;    asset 244 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x39, 0x37, 0x36, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 976;           */
+// app/file245.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*    asset 245 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x35, 0x20, /* 0;    asset 245  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x34, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 245;    asset */
+0x20, 0x32, 0x34, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  245 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x39, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 490;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 245 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x37, 0x33, 0x35, /*     var x3 = 735 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x35, 0x20, 0x6c, /* ;    asset 245 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x39, 0x38, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 980;    asset  */
+0x32, 0x34, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 245 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x32, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* r x5 = 1225;     */
+// app/file246.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x36, 0x20, 0x6c, 0x69, 0x6e, /*    asset 246 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x36, 0x20, /* 0;    asset 246  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x34, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 246;    asset */
+0x20, 0x32, 0x34, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  246 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x39, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 492;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 246 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x37, 0x33, 0x38, /*     var x3 = 738 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x36, 0x20, 0x6c, /* ;    asset 246 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x39, 0x38, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 984;    asset  */
+0x32, 0x34, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 246 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x33, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* r x5 = 1230;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, /* asset 246 line 6 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x34, 0x37, /*     var x6 = 147 */
+0x36, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 6;               */
+// app/file247.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*    asset 247 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x37, 0x20, /* 0;    asset 247  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x34, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 247;    asset */
+0x20, 0x32, 0x34, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  247 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x34, 0x39, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 494;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 247 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x37, 0x34, 0x31, /*     var x3 = 741 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x37, 0x20, 0x6c, /* ;    asset 247 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x39, 0x38, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, /* = 988;    asset  */
+0x32, 0x34, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, /* 247 line 5    va */
+0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x33, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* r x5 = 1235;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, /* asset 247 line 6 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x34, 0x38, /*     var x6 = 148 */
+0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x37, 0x20, /* 2;    asset 247  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x37, /* line 7    var x7 */
+0x20, 0x3d, 0x20, 0x31, 0x37, 0x32, 0x39, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 1729;         */
+// app/file248.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x38, 0x20, 0x6c, 0x69, 0x6e, /*    asset 248 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file249.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*    asset 249 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x34, 0x39, 0x20, /* 0;    asset 249  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x34, 0x39, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 249;          */
+// app/file250.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x30, 0x20, 0x6c, 0x69, 0x6e, /*    asset 250 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x30, 0x20, /* 0;    asset 250  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x35, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 250;    asset */
+0x20, 0x32, 0x35, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  250 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x30, 0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 500;     */
+// app/file251.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*    asset 251 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x31, 0x20, /* 0;    asset 251  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x35, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 251;    asset */
+0x20, 0x32, 0x35, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  251 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x30, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 502;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 251 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x37, 0x35, 0x33, /*     var x3 = 753 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file252.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x32, 0x20, 0x6c, 0x69, 0x6e, /*    asset 252 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x32, 0x20, /* 0;    asset 252  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x35, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 252;    asset */
+0x20, 0x32, 0x35, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  252 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x30, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 504;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 252 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x37, 0x35, 0x36, /*     var x3 = 756 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x32, 0x20, 0x6c, /* ;    asset 252 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x30, 0x30, 0x38, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 1008;          */
+// app/file253.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*    asset 253 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x33, 0x20, /* 0;    asset 253  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x35, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 253;    asset */
+0x20, 0x32, 0x35, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  253 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x30, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 506;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 253 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x37, 0x35, 0x39, /*     var x3 = 759 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x33, 0x20, 0x6c, /* ;    asset 253 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x30, 0x31, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* = 1012;    asset */
+0x20, 0x32, 0x35, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  253 line 5    v */
+0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x36, 0x35, 0x3b, 0x0a, 0x00, 0x00, /* ar x5 = 1265;    */
+// app/file254.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*    asset 254 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x34, 0x20, /* 0;    asset 254  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x35, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 254;    asset */
+0x20, 0x32, 0x35, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  254 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x30, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 508;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 254 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x37, 0x36, 0x32, /*     var x3 = 762 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x34, 0x20, 0x6c, /* ;    asset 254 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x30, 0x31, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* = 1016;    asset */
+0x20, 0x32, 0x35, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  254 line 5    v */
+0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x37, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, /* ar x5 = 1270;    */
+0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*  asset 254 line  */
+0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x35, /* 6    var x6 = 15 */
+0x32, 0x34, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 24;              */
+// app/file255.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*    asset 255 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x35, 0x20, /* 0;    asset 255  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x35, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 255;    asset */
+0x20, 0x32, 0x35, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  255 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x31, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 510;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 255 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x37, 0x36, 0x35, /*     var x3 = 765 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x35, 0x20, 0x6c, /* ;    asset 255 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x30, 0x32, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* = 1020;    asset */
+0x20, 0x32, 0x35, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  255 line 5    v */
+0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x37, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, /* ar x5 = 1275;    */
+0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*  asset 255 line  */
+0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x35, /* 6    var x6 = 15 */
+0x33, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x35, /* 30;    asset 255 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 7    var x */
+0x37, 0x20, 0x3d, 0x20, 0x31, 0x37, 0x38, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 7 = 1785;        */
+// app/file256.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x36, 0x20, 0x6c, 0x69, 0x6e, /*    asset 256 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file257.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*    asset 257 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x37, 0x20, /* 0;    asset 257  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x35, 0x37, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 257;          */
+// app/file258.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x38, 0x20, 0x6c, 0x69, 0x6e, /*    asset 258 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x38, 0x20, /* 0;    asset 258  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x35, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 258;    asset */
+0x20, 0x32, 0x35, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  258 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x31, 0x36, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 516;     */
+// app/file259.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*    asset 259 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x39, 0x20, /* 0;    asset 259  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x35, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 259;    asset */
+0x20, 0x32, 0x35, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  259 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x31, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 518;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x35, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 259 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x37, 0x37, 0x37, /*     var x3 = 777 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file260.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x30, 0x20, 0x6c, 0x69, 0x6e, /*    asset 260 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x30, 0x20, /* 0;    asset 260  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x36, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 260;    asset */
+0x20, 0x32, 0x36, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  260 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x32, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 520;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 260 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x37, 0x38, 0x30, /*     var x3 = 780 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x30, 0x20, 0x6c, /* ;    asset 260 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x30, 0x34, 0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 1040;          */
+// app/file261.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*    asset 261 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x31, 0x20, /* 0;    asset 261  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x36, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 261;    asset */
+0x20, 0x32, 0x36, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  261 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x32, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 522;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 261 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x37, 0x38, 0x33, /*     var x3 = 783 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x31, 0x20, 0x6c, /* ;    asset 261 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x30, 0x34, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* = 1044;    asset */
+0x20, 0x32, 0x36, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  261 line 5    v */
+0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x33, 0x30, 0x35, 0x3b, 0x0a, 0x00, 0x00, /* ar x5 = 1305;    */
+// app/file262.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x32, 0x20, 0x6c, 0x69, 0x6e, /*    asset 262 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x32, 0x20, /* 0;    asset 262  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x36, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 262;    asset */
+0x20, 0x32, 0x36, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  262 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x32, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 524;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 262 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x37, 0x38, 0x36, /*     var x3 = 786 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x32, 0x20, 0x6c, /* ;    asset 262 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x30, 0x34, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* = 1048;    asset */
+0x20, 0x32, 0x36, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  262 line 5    v */
+0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x33, 0x31, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, /* ar x5 = 1310;    */
+0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*  asset 262 line  */
+0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x35, /* 6    var x6 = 15 */
+0x37, 0x32, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 72;              */
+// app/file263.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*    asset 263 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x33, 0x20, /* 0;    asset 263  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x36, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 263;    asset */
+0x20, 0x32, 0x36, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  263 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x32, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 526;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 263 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x37, 0x38, 0x39, /*     var x3 = 789 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x33, 0x20, 0x6c, /* ;    asset 263 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x30, 0x35, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* = 1052;    asset */
+0x20, 0x32, 0x36, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  263 line 5    v */
+0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x33, 0x31, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, /* ar x5 = 1315;    */
+0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*  asset 263 line  */
+0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x35, /* 6    var x6 = 15 */
+0x37, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x33, /* 78;    asset 263 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 7    var x */
+0x37, 0x20, 0x3d, 0x20, 0x31, 0x38, 0x34, 0x31, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 7 = 1841;        */
+// app/file264.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*    asset 264 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file265.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*    asset 265 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x35, 0x20, /* 0;    asset 265  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x36, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 265;          */
+// app/file266.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x36, 0x20, 0x6c, 0x69, 0x6e, /*    asset 266 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x36, 0x20, /* 0;    asset 266  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x36, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 266;    asset */
+0x20, 0x32, 0x36, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  266 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x33, 0x32, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 532;     */
+// app/file267.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*    asset 267 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x37, 0x20, /* 0;    asset 267  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x36, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 267;    asset */
+0x20, 0x32, 0x36, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  267 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x33, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 534;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 267 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x30, 0x31, /*     var x3 = 801 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file268.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x38, 0x20, 0x6c, 0x69, 0x6e, /*    asset 268 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x38, 0x20, /* 0;    asset 268  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x36, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 268;    asset */
+0x20, 0x32, 0x36, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  268 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x33, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 536;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 268 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x30, 0x34, /*     var x3 = 804 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x38, 0x20, 0x6c, /* ;    asset 268 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x30, 0x37, 0x32, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 1072;          */
+// app/file269.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*    asset 269 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x39, 0x20, /* 0;    asset 269  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x36, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 269;    asset */
+0x20, 0x32, 0x36, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  269 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x33, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 538;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 269 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x30, 0x37, /*     var x3 = 807 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x36, 0x39, 0x20, 0x6c, /* ;    asset 269 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x30, 0x37, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* = 1076;    asset */
+0x20, 0x32, 0x36, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  269 line 5    v */
+0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x33, 0x34, 0x35, 0x3b, 0x0a, 0x00, 0x00, /* ar x5 = 1345;    */
+// app/file270.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x30, 0x20, 0x6c, 0x69, 0x6e, /*    asset 270 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x30, 0x20, /* 0;    asset 270  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x37, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 270;    asset */
+0x20, 0x32, 0x37, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  270 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x34, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 540;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 270 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x31, 0x30, /*     var x3 = 810 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x30, 0x20, 0x6c, /* ;    asset 270 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x30, 0x38, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* = 1080;    asset */
+0x20, 0x32, 0x37, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  270 line 5    v */
+0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x33, 0x35, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, /* ar x5 = 1350;    */
+0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*  asset 270 line  */
+0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x36, /* 6    var x6 = 16 */
+0x32, 0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 20;              */
+// app/file271.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*    asset 271 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x31, 0x20, /* 0;    asset 271  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x37, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 271;    asset */
+0x20, 0x32, 0x37, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  271 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x34, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 542;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 271 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x31, 0x33, /*     var x3 = 813 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x31, 0x20, 0x6c, /* ;    asset 271 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x30, 0x38, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* = 1084;    asset */
+0x20, 0x32, 0x37, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  271 line 5    v */
+0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x33, 0x35, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, /* ar x5 = 1355;    */
+0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*  asset 271 line  */
+0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x36, /* 6    var x6 = 16 */
+0x32, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x31, /* 26;    asset 271 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 7    var x */
+0x37, 0x20, 0x3d, 0x20, 0x31, 0x38, 0x39, 0x37, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 7 = 1897;        */
+// app/file272.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x32, 0x20, 0x6c, 0x69, 0x6e, /*    asset 272 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file273.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*    asset 273 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x33, 0x20, /* 0;    asset 273  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x37, 0x33, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 273;          */
+// app/file274.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*    asset 274 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x34, 0x20, /* 0;    asset 274  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x37, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 274;    asset */
+0x20, 0x32, 0x37, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  274 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x34, 0x38, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 548;     */
+// app/file275.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*    asset 275 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x35, 0x20, /* 0;    asset 275  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x37, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 275;    asset */
+0x20, 0x32, 0x37, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  275 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x35, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 550;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 275 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x32, 0x35, /*     var x3 = 825 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file276.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x36, 0x20, 0x6c, 0x69, 0x6e, /*    asset 276 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x36, 0x20, /* 0;    asset 276  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x37, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 276;    asset */
+0x20, 0x32, 0x37, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  276 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x35, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 552;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 276 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x32, 0x38, /*     var x3 = 828 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x36, 0x20, 0x6c, /* ;    asset 276 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x31, 0x30, 0x34, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 1104;          */
+// app/file277.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*    asset 277 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x37, 0x20, /* 0;    asset 277  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x37, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 277;    asset */
+0x20, 0x32, 0x37, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  277 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x35, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 554;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 277 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x33, 0x31, /*     var x3 = 831 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x37, 0x20, 0x6c, /* ;    asset 277 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x31, 0x30, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* = 1108;    asset */
+0x20, 0x32, 0x37, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  277 line 5    v */
+0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x33, 0x38, 0x35, 0x3b, 0x0a, 0x00, 0x00, /* ar x5 = 1385;    */
+// app/file278.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x38, 0x20, 0x6c, 0x69, 0x6e, /*    asset 278 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x38, 0x20, /* 0;    asset 278  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x37, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 278;    asset */
+0x20, 0x32, 0x37, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  278 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x35, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 556;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 278 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x33, 0x34, /*     var x3 = 834 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x38, 0x20, 0x6c, /* ;    asset 278 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x31, 0x31, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* = 1112;    asset */
+0x20, 0x32, 0x37, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  278 line 5    v */
+0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x33, 0x39, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, /* ar x5 = 1390;    */
+0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*  asset 278 line  */
+0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x36, /* 6    var x6 = 16 */
+0x36, 0x38, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 68;              */
+// app/file279.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*    asset 279 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x39, 0x20, /* 0;    asset 279  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x37, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 279;    asset */
+0x20, 0x32, 0x37, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  279 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x35, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 558;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 279 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x33, 0x37, /*     var x3 = 837 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x39, 0x20, 0x6c, /* ;    asset 279 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x31, 0x31, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* = 1116;    asset */
+0x20, 0x32, 0x37, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  279 line 5    v */
+0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x33, 0x39, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, /* ar x5 = 1395;    */
+0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*  asset 279 line  */
+0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x36, /* 6    var x6 = 16 */
+0x37, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x37, 0x39, /* 74;    asset 279 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 7    var x */
+0x37, 0x20, 0x3d, 0x20, 0x31, 0x39, 0x35, 0x33, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 7 = 1953;        */
+// app/file280.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x30, 0x20, 0x6c, 0x69, 0x6e, /*    asset 280 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file281.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*    asset 281 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x31, 0x20, /* 0;    asset 281  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x38, 0x31, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 281;          */
+// app/file282.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x32, 0x20, 0x6c, 0x69, 0x6e, /*    asset 282 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x32, 0x20, /* 0;    asset 282  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x38, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 282;    asset */
+0x20, 0x32, 0x38, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  282 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x36, 0x34, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 564;     */
+// app/file283.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*    asset 283 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x33, 0x20, /* 0;    asset 283  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x38, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 283;    asset */
+0x20, 0x32, 0x38, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  283 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x36, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 566;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 283 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x34, 0x39, /*     var x3 = 849 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file284.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*    asset 284 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x34, 0x20, /* 0;    asset 284  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x38, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 284;    asset */
+0x20, 0x32, 0x38, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  284 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x36, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 568;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 284 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x35, 0x32, /*     var x3 = 852 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x34, 0x20, 0x6c, /* ;    asset 284 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x31, 0x33, 0x36, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 1136;          */
+// app/file285.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*    asset 285 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x35, 0x20, /* 0;    asset 285  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x38, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 285;    asset */
+0x20, 0x32, 0x38, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  285 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x37, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 570;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 285 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x35, 0x35, /*     var x3 = 855 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x35, 0x20, 0x6c, /* ;    asset 285 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x31, 0x34, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* = 1140;    asset */
+0x20, 0x32, 0x38, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  285 line 5    v */
+0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x34, 0x32, 0x35, 0x3b, 0x0a, 0x00, 0x00, /* ar x5 = 1425;    */
+// app/file286.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x36, 0x20, 0x6c, 0x69, 0x6e, /*    asset 286 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x36, 0x20, /* 0;    asset 286  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x38, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 286;    asset */
+0x20, 0x32, 0x38, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  286 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x37, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 572;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 286 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x35, 0x38, /*     var x3 = 858 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x36, 0x20, 0x6c, /* ;    asset 286 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x31, 0x34, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* = 1144;    asset */
+0x20, 0x32, 0x38, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  286 line 5    v */
+0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x34, 0x33, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, /* ar x5 = 1430;    */
+0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x36, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*  asset 286 line  */
+0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x37, /* 6    var x6 = 17 */
+0x31, 0x36, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 16;              */
+// app/file287.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*    asset 287 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x37, 0x20, /* 0;    asset 287  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x38, 0x37, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 287;    asset */
+0x20, 0x32, 0x38, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  287 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x37, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 574;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 287 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x36, 0x31, /*     var x3 = 861 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x37, 0x20, 0x6c, /* ;    asset 287 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x31, 0x34, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* = 1148;    asset */
+0x20, 0x32, 0x38, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  287 line 5    v */
+0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x34, 0x33, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, /* ar x5 = 1435;    */
+0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x37, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*  asset 287 line  */
+0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x37, /* 6    var x6 = 17 */
+0x32, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x37, /* 22;    asset 287 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 7    var x */
+0x37, 0x20, 0x3d, 0x20, 0x32, 0x30, 0x30, 0x39, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 7 = 2009;        */
+// app/file288.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x38, 0x20, 0x6c, 0x69, 0x6e, /*    asset 288 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file289.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*    asset 289 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x38, 0x39, 0x20, /* 0;    asset 289  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x38, 0x39, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 289;          */
+// app/file290.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x30, 0x20, 0x6c, 0x69, 0x6e, /*    asset 290 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x30, 0x20, /* 0;    asset 290  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x39, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 290;    asset */
+0x20, 0x32, 0x39, 0x30, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  290 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x38, 0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 580;     */
+// app/file291.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x31, 0x20, 0x6c, 0x69, 0x6e, /*    asset 291 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x31, 0x20, /* 0;    asset 291  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x39, 0x31, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 291;    asset */
+0x20, 0x32, 0x39, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  291 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x38, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 582;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x31, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 291 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x37, 0x33, /*     var x3 = 873 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+// app/file292.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x32, 0x20, 0x6c, 0x69, 0x6e, /*    asset 292 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x32, 0x20, /* 0;    asset 292  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x39, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 292;    asset */
+0x20, 0x32, 0x39, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  292 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x38, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 584;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x32, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 292 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x37, 0x36, /*     var x3 = 876 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x32, 0x20, 0x6c, /* ;    asset 292 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x31, 0x36, 0x38, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* = 1168;          */
+// app/file293.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x33, 0x20, 0x6c, 0x69, 0x6e, /*    asset 293 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x33, 0x20, /* 0;    asset 293  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x39, 0x33, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 293;    asset */
+0x20, 0x32, 0x39, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  293 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x38, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 586;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 293 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x37, 0x39, /*     var x3 = 879 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x33, 0x20, 0x6c, /* ;    asset 293 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x31, 0x37, 0x32, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* = 1172;    asset */
+0x20, 0x32, 0x39, 0x33, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  293 line 5    v */
+0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x34, 0x36, 0x35, 0x3b, 0x0a, 0x00, 0x00, /* ar x5 = 1465;    */
+// app/file294.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x34, 0x20, 0x6c, 0x69, 0x6e, /*    asset 294 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x34, 0x20, /* 0;    asset 294  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x39, 0x34, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 294;    asset */
+0x20, 0x32, 0x39, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  294 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x38, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 588;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 294 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x38, 0x32, /*     var x3 = 882 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x34, 0x20, 0x6c, /* ;    asset 294 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x31, 0x37, 0x36, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* = 1176;    asset */
+0x20, 0x32, 0x39, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  294 line 5    v */
+0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x34, 0x37, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, /* ar x5 = 1470;    */
+0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x34, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*  asset 294 line  */
+0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x37, /* 6    var x6 = 17 */
+0x36, 0x34, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 64;              */
+// app/file295.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x35, 0x20, 0x6c, 0x69, 0x6e, /*    asset 295 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x35, 0x20, /* 0;    asset 295  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x39, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 295;    asset */
+0x20, 0x32, 0x39, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  295 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x39, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 590;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 295 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x38, 0x35, /*     var x3 = 885 */
+0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x35, 0x20, 0x6c, /* ;    asset 295 l */
+0x69, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x34, 0x20, /* ine 4    var x4  */
+0x3d, 0x20, 0x31, 0x31, 0x38, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /* = 1180;    asset */
+0x20, 0x32, 0x39, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x35, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  295 line 5    v */
+0x61, 0x72, 0x20, 0x78, 0x35, 0x20, 0x3d, 0x20, 0x31, 0x34, 0x37, 0x35, 0x3b, 0x0a, 0x2f, 0x2a, /* ar x5 = 1475;    */
+0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x35, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, /*  asset 295 line  */
+0x36, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x37, /* 6    var x6 = 17 */
+0x37, 0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x35, /* 70;    asset 295 */
+0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, /*  line 7    var x */
+0x37, 0x20, 0x3d, 0x20, 0x32, 0x30, 0x36, 0x35, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 7 = 2065;        */
+// app/file296.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x36, 0x20, 0x6c, 0x69, 0x6e, /*    asset 296 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0;               */
+// app/file297.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x37, 0x20, 0x6c, 0x69, 0x6e, /*    asset 297 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x37, 0x20, /* 0;    asset 297  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x39, 0x37, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*  = 297;          */
+// app/file298.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x38, 0x20, 0x6c, 0x69, 0x6e, /*    asset 298 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x38, 0x20, /* 0;    asset 298  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x39, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 298;    asset */
+0x20, 0x32, 0x39, 0x38, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  298 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x39, 0x36, 0x3b, 0x0a, 0x00, 0x00, 0x00, /* ar x2 = 596;     */
+// app/file299.js
+0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x39, 0x20, 0x6c, 0x69, 0x6e, /*    asset 299 lin */
+0x65, 0x20, 0x30, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, /* e 0    var x0 =  */
+0x30, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x39, 0x20, /* 0;    asset 299  */
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x31, 0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x31, /* line 1    var x1 */
+0x20, 0x3d, 0x20, 0x32, 0x39, 0x39, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x73, 0x73, 0x65, 0x74, /*  = 299;    asset */
+0x20, 0x32, 0x39, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x20, 0x2a, 0x2f, 0x20, 0x76, /*  299 line 2    v */
+0x61, 0x72, 0x20, 0x78, 0x32, 0x20, 0x3d, 0x20, 0x35, 0x39, 0x38, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, /* ar x2 = 598;     */
+0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x32, 0x39, 0x39, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, /* asset 299 line 3 */
+0x20, 0x2a, 0x2f, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x33, 0x20, 0x3d, 0x20, 0x38, 0x39, 0x37, /*     var x3 = 897 */
+0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ;                */
+};
+
+constexpr char paths[] =
+    "app/file0.js" "\0"
+    "app/file1.js" "\0"
+    "app/file2.js" "\0"
+    "app/file3.js" "\0"
+    "app/file4.js" "\0"
+    "app/file5.js" "\0"
+    "app/file6.js" "\0"
+    "app/file7.js" "\0"
+    "app/file8.js" "\0"
+    "app/file9.js" "\0"
+    "app/file10.js" "\0"
+    "app/file11.js" "\0"
+    "app/file12.js" "\0"
+    "app/file13.js" "\0"
+    "app/file14.js" "\0"
+    "app/file15.js" "\0"
+    "app/file16.js" "\0"
+    "app/file17.js" "\0"
+    "app/file18.js" "\0"
+    "app/file19.js" "\0"
+    "app/file20.js" "\0"
+    "app/file21.js" "\0"
+    "app/file22.js" "\0"
+    "app/file23.js" "\0"
+    "app/file24.js" "\0"
+    "app/file25.js" "\0"
+    "app/file26.js" "\0"
+    "app/file27.js" "\0"
+    "app/file28.js" "\0"
+    "app/file29.js" "\0"
+    "app/file30.js" "\0"
+    "app/file31.js" "\0"
+    "app/file32.js" "\0"
+    "app/file33.js" "\0"
+    "app/file34.js" "\0"
+    "app/file35.js" "\0"
+    "app/file36.js" "\0"
+    "app/file37.js" "\0"
+    "app/file38.js" "\0"
+    "app/file39.js" "\0"
+    "app/file40.js" "\0"
+    "app/file41.js" "\0"
+    "app/file42.js" "\0"
+    "app/file43.js" "\0"
+    "app/file44.js" "\0"
+    "app/file45.js" "\0"
+    "app/file46.js" "\0"
+    "app/file47.js" "\0"
+    "app/file48.js" "\0"
+    "app/file49.js" "\0"
+    "app/file50.js" "\0"
+    "app/file51.js" "\0"
+    "app/file52.js" "\0"
+    "app/file53.js" "\0"
+    "app/file54.js" "\0"
+    "app/file55.js" "\0"
+    "app/file56.js" "\0"
+    "app/file57.js" "\0"
+    "app/file58.js" "\0"
+    "app/file59.js" "\0"
+    "app/file60.js" "\0"
+    "app/file61.js" "\0"
+    "app/file62.js" "\0"
+    "app/file63.js" "\0"
+    "app/file64.js" "\0"
+    "app/file65.js" "\0"
+    "app/file66.js" "\0"
+    "app/file67.js" "\0"
+    "app/file68.js" "\0"
+    "app/file69.js" "\0"
+    "app/file70.js" "\0"
+    "app/file71.js" "\0"
+    "app/file72.js" "\0"
+    "app/file73.js" "\0"
+    "app/file74.js" "\0"
+    "app/file75.js" "\0"
+    "app/file76.js" "\0"
+    "app/file77.js" "\0"
+    "app/file78.js" "\0"
+    "app/file79.js" "\0"
+    "app/file80.js" "\0"
+    "app/file81.js" "\0"
+    "app/file82.js" "\0"
+    "app/file83.js" "\0"
+    "app/file84.js" "\0"
+    "app/file85.js" "\0"
+    "app/file86.js" "\0"
+    "app/file87.js" "\0"
+    "app/file88.js" "\0"
+    "app/file89.js" "\0"
+    "app/file90.js" "\0"
+    "app/file91.js" "\0"
+    "app/file92.js" "\0"
+    "app/file93.js" "\0"
+    "app/file94.js" "\0"
+    "app/file95.js" "\0"
+    "app/file96.js" "\0"
+    "app/file97.js" "\0"
+    "app/file98.js" "\0"
+    "app/file99.js" "\0"
+    "app/file100.js" "\0"
+    "app/file101.js" "\0"
+    "app/file102.js" "\0"
+    "app/file103.js" "\0"
+    "app/file104.js" "\0"
+    "app/file105.js" "\0"
+    "app/file106.js" "\0"
+    "app/file107.js" "\0"
+    "app/file108.js" "\0"
+    "app/file109.js" "\0"
+    "app/file110.js" "\0"
+    "app/file111.js" "\0"
+    "app/file112.js" "\0"
+    "app/file113.js" "\0"
+    "app/file114.js" "\0"
+    "app/file115.js" "\0"
+    "app/file116.js" "\0"
+    "app/file117.js" "\0"
+    "app/file118.js" "\0"
+    "app/file119.js" "\0"
+    "app/file120.js" "\0"
+    "app/file121.js" "\0"
+    "app/file122.js" "\0"
+    "app/file123.js" "\0"
+    "app/file124.js" "\0"
+    "app/file125.js" "\0"
+    "app/file126.js" "\0"
+    "app/file127.js" "\0"
+    "app/file128.js" "\0"
+    "app/file129.js" "\0"
+    "app/file130.js" "\0"
+    "app/file131.js" "\0"
+    "app/file132.js" "\0"
+    "app/file133.js" "\0"
+    "app/file134.js" "\0"
+    "app/file135.js" "\0"
+    "app/file136.js" "\0"
+    "app/file137.js" "\0"
+    "app/file138.js" "\0"
+    "app/file139.js" "\0"
+    "app/file140.js" "\0"
+    "app/file141.js" "\0"
+    "app/file142.js" "\0"
+    "app/file143.js" "\0"
+    "app/file144.js" "\0"
+    "app/file145.js" "\0"
+    "app/file146.js" "\0"
+    "app/file147.js" "\0"
+    "app/file148.js" "\0"
+    "app/file149.js" "\0"
+    "app/file150.js" "\0"
+    "app/file151.js" "\0"
+    "app/file152.js" "\0"
+    "app/file153.js" "\0"
+    "app/file154.js" "\0"
+    "app/file155.js" "\0"
+    "app/file156.js" "\0"
+    "app/file157.js" "\0"
+    "app/file158.js" "\0"
+    "app/file159.js" "\0"
+    "app/file160.js" "\0"
+    "app/file161.js" "\0"
+    "app/file162.js" "\0"
+    "app/file163.js" "\0"
+    "app/file164.js" "\0"
+    "app/file165.js" "\0"
+    "app/file166.js" "\0"
+    "app/file167.js" "\0"
+    "app/file168.js" "\0"
+    "app/file169.js" "\0"
+    "app/file170.js" "\0"
+    "app/file171.js" "\0"
+    "app/file172.js" "\0"
+    "app/file173.js" "\0"
+    "app/file174.js" "\0"
+    "app/file175.js" "\0"
+    "app/file176.js" "\0"
+    "app/file177.js" "\0"
+    "app/file178.js" "\0"
+    "app/file179.js" "\0"
+    "app/file180.js" "\0"
+    "app/file181.js" "\0"
+    "app/file182.js" "\0"
+    "app/file183.js" "\0"
+    "app/file184.js" "\0"
+    "app/file185.js" "\0"
+    "app/file186.js" "\0"
+    "app/file187.js" "\0"
+    "app/file188.js" "\0"
+    "app/file189.js" "\0"
+    "app/file190.js" "\0"
+    "app/file191.js" "\0"
+    "app/file192.js" "\0"
+    "app/file193.js" "\0"
+    "app/file194.js" "\0"
+    "app/file195.js" "\0"
+    "app/file196.js" "\0"
+    "app/file197.js" "\0"
+    "app/file198.js" "\0"
+    "app/file199.js" "\0"
+    "app/file200.js" "\0"
+    "app/file201.js" "\0"
+    "app/file202.js" "\0"
+    "app/file203.js" "\0"
+    "app/file204.js" "\0"
+    "app/file205.js" "\0"
+    "app/file206.js" "\0"
+    "app/file207.js" "\0"
+    "app/file208.js" "\0"
+    "app/file209.js" "\0"
+    "app/file210.js" "\0"
+    "app/file211.js" "\0"
+    "app/file212.js" "\0"
+    "app/file213.js" "\0"
+    "app/file214.js" "\0"
+    "app/file215.js" "\0"
+    "app/file216.js" "\0"
+    "app/file217.js" "\0"
+    "app/file218.js" "\0"
+    "app/file219.js" "\0"
+    "app/file220.js" "\0"
+    "app/file221.js" "\0"
+    "app/file222.js" "\0"
+    "app/file223.js" "\0"
+    "app/file224.js" "\0"
+    "app/file225.js" "\0"
+    "app/file226.js" "\0"
+    "app/file227.js" "\0"
+    "app/file228.js" "\0"
+    "app/file229.js" "\0"
+    "app/file230.js" "\0"
+    "app/file231.js" "\0"
+    "app/file232.js" "\0"
+    "app/file233.js" "\0"
+    "app/file234.js" "\0"
+    "app/file235.js" "\0"
+    "app/file236.js" "\0"
+    "app/file237.js" "\0"
+    "app/file238.js" "\0"
+    "app/file239.js" "\0"
+    "app/file240.js" "\0"
+    "app/file241.js" "\0"
+    "app/file242.js" "\0"
+    "app/file243.js" "\0"
+    "app/file244.js" "\0"
+    "app/file245.js" "\0"
+    "app/file246.js" "\0"
+    "app/file247.js" "\0"
+    "app/file248.js" "\0"
+    "app/file249.js" "\0"
+    "app/file250.js" "\0"
+    "app/file251.js" "\0"
+    "app/file252.js" "\0"
+    "app/file253.js" "\0"
+    "app/file254.js" "\0"
+    "app/file255.js" "\0"
+    "app/file256.js" "\0"
+    "app/file257.js" "\0"
+    "app/file258.js" "\0"
+    "app/file259.js" "\0"
+    "app/file260.js" "\0"
+    "app/file261.js" "\0"
+    "app/file262.js" "\0"
+    "app/file263.js" "\0"
+    "app/file264.js" "\0"
+    "app/file265.js" "\0"
+    "app/file266.js" "\0"
+    "app/file267.js" "\0"
+    "app/file268.js" "\0"
+    "app/file269.js" "\0"
+    "app/file270.js" "\0"
+    "app/file271.js" "\0"
+    "app/file272.js" "\0"
+    "app/file273.js" "\0"
+    "app/file274.js" "\0"
+    "app/file275.js" "\0"
+    "app/file276.js" "\0"
+    "app/file277.js" "\0"
+    "app/file278.js" "\0"
+    "app/file279.js" "\0"
+    "app/file280.js" "\0"
+    "app/file281.js" "\0"
+    "app/file282.js" "\0"
+    "app/file283.js" "\0"
+    "app/file284.js" "\0"
+    "app/file285.js" "\0"
+    "app/file286.js" "\0"
+    "app/file287.js" "\0"
+    "app/file288.js" "\0"
+    "app/file289.js" "\0"
+    "app/file290.js" "\0"
+    "app/file291.js" "\0"
+    "app/file292.js" "\0"
+    "app/file293.js" "\0"
+    "app/file294.js" "\0"
+    "app/file295.js" "\0"
+    "app/file296.js" "\0"
+    "app/file297.js" "\0"
+    "app/file298.js" "\0"
+    "app/file299.js" "\0"
+    "";
+
+constexpr const char* mimes[] = {
+    "application/javascript",
+    nullptr
+};
+
+constexpr s::wui::packed_assets::entry entries[] = {
+    {1236, 13, 14720, 69, 69, 0, false, false}, // app/file89.js
+    {1645, 14, 19376, 220, 220, 0, false, false}, // app/file117.js
+    {536, 13, 6320, 284, 284, 0, false, false}, // app/file39.js
+    {2080, 14, 24480, 109, 109, 0, false, false}, // app/file146.js
+    {3460, 14, 40480, 259, 259, 0, false, false}, // app/file238.js
+    {1855, 14, 21808, 146, 146, 0, false, false}, // app/file131.js
+    {4360, 14, 50928, 109, 109, 0, false, false}, // app/file298.js
+    {4180, 14, 48832, 260, 260, 0, false, false}, // app/file286.js
+    {690, 13, 8080, 105, 105, 0, false, false}, // app/file50.js
+    {3550, 14, 41456, 183, 183, 0, false, false}, // app/file244.js
+    {452, 13, 5312, 69, 69, 0, false, false}, // app/file33.js
+    {2155, 14, 25440, 295, 295, 0, false, false}, // app/file151.js
+    {1765, 14, 20768, 220, 220, 0, false, false}, // app/file125.js
+    {2245, 14, 26336, 220, 220, 0, false, false}, // app/file157.js
+    {326, 13, 3936, 34, 34, 0, false, false}, // app/file24.js
+    {1068, 13, 12560, 213, 213, 0, false, false}, // app/file77.js
+    {4240, 14, 49536, 109, 109, 0, false, false}, // app/file290.js
+    {760, 13, 9008, 285, 285, 0, false, false}, // app/file55.js
+    {3520, 14, 41184, 109, 109, 0, false, false}, // app/file242.js
+    {3490, 14, 41056, 35, 35, 0, false, false}, // app/file240.js
+    {928, 13, 10880, 141, 141, 0, false, false}, // app/file67.js
+    {3535, 14, 41296, 146, 146, 0, false, false}, // app/file243.js
+    {4375, 14, 51040, 146, 146, 0, false, false}, // app/file299.js
+    {3040, 14, 35616, 109, 109, 0, false, false}, // app/file210.js
+    {746, 13, 8752, 249, 249, 0, false, false}, // app/file54.js
+    {718, 13, 8336, 177, 177, 0, false, false}, // app/file52.js
+    {4195, 14, 49104, 298, 298, 0, false, false}, // app/file287.js
+    {1082, 13, 12784, 249, 249, 0, false, false}, // app/file78.js
+    {984, 13, 11696, 285, 285, 0, false, false}, // app/file71.js
+    {1420, 14, 16816, 257, 257, 0, false, false}, // app/file102.js
+    {65, 12, 560, 202, 202, 0, false, false}, // app/file5.js
+    {1930, 14, 22960, 35, 35, 0, false, false}, // app/file136.js
+    {1264, 13, 14912, 141, 141, 0, false, false}, // app/file91.js
+    {2755, 14, 32400, 296, 296, 0, false, false}, // app/file191.js
+    {1222, 13, 14672, 34, 34, 0, false, false}, // app/file88.js
+    {3265, 14, 38320, 72, 72, 0, false, false}, // app/file225.js
+    {2170, 14, 25744, 35, 35, 0, false, false}, // app/file152.js
+    {3895, 14, 45472, 146, 146, 0, false, false}, // app/file267.js
+    {872, 13, 10352, 285, 285, 0, false, false}, // app/file63.js
+    {3805, 14, 44432, 222, 222, 0, false, false}, // app/file261.js
+    {1208, 13, 14384, 285, 285, 0, false, false}, // app/file87.js
+    {2065, 14, 24400, 72, 72, 0, false, false}, // app/file145.js
+    {354, 13, 4064, 104, 104, 0, false, false}, // app/file26.js
+    {1885, 14, 22160, 220, 220, 0, false, false}, // app/file133.js
+    {1040, 13, 12224, 141, 141, 0, false, false}, // app/file75.js
+    {2605, 14, 30512, 220, 220, 0, false, false}, // app/file181.js
+    {620, 13, 7184, 212, 212, 0, false, false}, // app/file45.js
+    {2125, 14, 24944, 220, 220, 0, false, false}, // app/file149.js
+    {2515, 14, 29616, 296, 296, 0, false, false}, // app/file175.js
+    {2995, 14, 35184, 297, 297, 0, false, false}, // app/file207.js
+    {1570, 14, 18784, 35, 35, 0, false, false}, // app/file112.js
+    {1180, 13, 13904, 213, 213, 0, false, false}, // app/file85.js
+    {2980, 14, 34912, 259, 259, 0, false, false}, // app/file206.js
+    {144, 13, 1520, 139, 139, 0, false, false}, // app/file11.js
+    {3865, 14, 45280, 72, 72, 0, false, false}, // app/file265.js
+    {1660, 14, 19600, 257, 257, 0, false, false}, // app/file118.js
+    {3955, 14, 46320, 298, 298, 0, false, false}, // app/file271.js
+    {4225, 14, 49456, 72, 72, 0, false, false}, // app/file289.js
+    {172, 13, 1840, 209, 209, 0, false, false}, // app/file13.js
+    {39, 12, 240, 132, 132, 0, false, false}, // app/file3.js
+    {1915, 14, 22656, 294, 294, 0, false, false}, // app/file135.js
+    {2305, 14, 27184, 72, 72, 0, false, false}, // app/file161.js
+    {368, 13, 4176, 139, 139, 0, false, false}, // app/file27.js
+    {2785, 14, 32752, 72, 72, 0, false, false}, // app/file193.js
+    {2215, 14, 25984, 146, 146, 0, false, false}, // app/file155.js
+    {2440, 14, 28656, 109, 109, 0, false, false}, // app/file170.js
+    {2965, 14, 34688, 221, 221, 0, false, false}, // app/file205.js
+    {480, 13, 5504, 140, 140, 0, false, false}, // app/file35.js
+    {1292, 13, 15248, 213, 213, 0, false, false}, // app/file93.js
+    {340, 13, 3984, 69, 69, 0, false, false}, // app/file25.js
+    {2485, 14, 29120, 220, 220, 0, false, false}, // app/file173.js
+    {1525, 14, 17984, 220, 220, 0, false, false}, // app/file109.js
+    {3340, 14, 39088, 259, 259, 0, false, false}, // app/file230.js
+    {1250, 13, 14800, 105, 105, 0, false, false}, // app/file90.js
+    {4315, 14, 50496, 298, 298, 0, false, false}, // app/file295.js
+    {1510, 14, 17792, 183, 183, 0, false, false}, // app/file108.js
+    {2275, 14, 26832, 295, 295, 0, false, false}, // app/file159.js
+    {606, 13, 6992, 176, 176, 0, false, false}, // app/file44.js
+    {3385, 14, 39712, 72, 72, 0, false, false}, // app/file233.js
+    {2665, 14, 31360, 72, 72, 0, false, false}, // app/file185.js
+    {2500, 14, 29344, 258, 258, 0, false, false}, // app/file174.js
+    {3790, 14, 44240, 184, 184, 0, false, false}, // app/file260.js
+    {2050, 14, 24352, 35, 35, 0, false, false}, // app/file144.js
+    {4090, 14, 48016, 35, 35, 0, false, false}, // app/file280.js
+    {2650, 14, 31312, 35, 35, 0, false, false}, // app/file184.js
+    {200, 13, 2320, 280, 280, 0, false, false}, // app/file15.js
+    {1348, 13, 16064, 69, 69, 0, false, false}, // app/file97.js
+    {1990, 14, 23360, 183, 183, 0, false, false}, // app/file140.js
+    {1960, 14, 23088, 109, 109, 0, false, false}, // app/file138.js
+    {4345, 14, 50848, 72, 72, 0, false, false}, // app/file297.js
+    {3700, 14, 43264, 260, 260, 0, false, false}, // app/file254.js
+    {970, 13, 11440, 249, 249, 0, false, false}, // app/file70.js
+    {1555, 14, 18480, 294, 294, 0, false, false}, // app/file111.js
+    {1450, 14, 17392, 35, 35, 0, false, false}, // app/file104.js
+    {1152, 13, 13568, 141, 141, 0, false, false}, // app/file83.js
+    {2950, 14, 34496, 183, 183, 0, false, false}, // app/file204.js
+    {3670, 14, 42848, 184, 184, 0, false, false}, // app/file252.js
+    {242, 13, 2736, 104, 104, 0, false, false}, // app/file18.js
+    {2005, 14, 23552, 220, 220, 0, false, false}, // app/file141.js
+    {942, 13, 11024, 177, 177, 0, false, false}, // app/file68.js
+    {3475, 14, 40752, 297, 297, 0, false, false}, // app/file239.js
+    {2260, 14, 26560, 257, 257, 0, false, false}, // app/file158.js
+    {732, 13, 8528, 213, 213, 0, false, false}, // app/file53.js
+    {186, 13, 2064, 244, 244, 0, false, false}, // app/file14.js
+    {2590, 14, 30320, 183, 183, 0, false, false}, // app/file180.js
+    {1390, 14, 16400, 183, 183, 0, false, false}, // app/file100.js
+    {4000, 14, 46752, 109, 109, 0, false, false}, // app/file274.js
+    {2905, 14, 34144, 72, 72, 0, false, false}, // app/file201.js
+    {0, 12, 0, 33, 33, 0, false, false}, // app/file0.js
+    {676, 13, 8000, 69, 69, 0, false, false}, // app/file49.js
+    {3145, 14, 36928, 72, 72, 0, false, false}, // app/file217.js
+    {2380, 14, 27952, 257, 257, 0, false, false}, // app/file166.js
+    {1362, 13, 16144, 105, 105, 0, false, false}, // app/file98.js
+    {3295, 14, 38512, 146, 146, 0, false, false}, // app/file227.js
+    {3310, 14, 38672, 183, 183, 0, false, false}, // app/file228.js
+    {312, 13, 3648, 282, 282, 0, false, false}, // app/file23.js
+    {3940, 14, 46048, 260, 260, 0, false, false}, // app/file270.js
+    {1540, 14, 18208, 257, 257, 0, false, false}, // app/file110.js
+    {3055, 14, 35728, 146, 146, 0, false, false}, // app/file211.js
+    {1495, 14, 17632, 146, 146, 0, false, false}, // app/file107.js
+    {3010, 14, 35488, 35, 35, 0, false, false}, // app/file208.js
+    {4255, 14, 49648, 146, 146, 0, false, false}, // app/file291.js
+    {3505, 14, 41104, 72, 72, 0, false, false}, // app/file241.js
+    {1012, 13, 12032, 69, 69, 0, false, false}, // app/file73.js
+    {2845, 14, 33296, 220, 220, 0, false, false}, // app/file197.js
+    {2935, 14, 34336, 146, 146, 0, false, false}, // app/file203.js
+    {3370, 14, 39664, 35, 35, 0, false, false}, // app/file232.js
+    {382, 13, 4320, 175, 175, 0, false, false}, // app/file28.js
+    {438, 13, 5264, 34, 34, 0, false, false}, // app/file32.js
+    {1194, 13, 14128, 249, 249, 0, false, false}, // app/file86.js
+    {3985, 14, 46672, 72, 72, 0, false, false}, // app/file273.js
+    {1026, 13, 12112, 105, 105, 0, false, false}, // app/file74.js
+    {1675, 14, 19872, 294, 294, 0, false, false}, // app/file119.js
+    {4075, 14, 47712, 298, 298, 0, false, false}, // app/file279.js
+    {3190, 14, 37280, 183, 183, 0, false, false}, // app/file220.js
+    {900, 13, 10688, 69, 69, 0, false, false}, // app/file65.js
+    {3610, 14, 42448, 35, 35, 0, false, false}, // app/file248.js
+    {3820, 14, 44656, 260, 260, 0, false, false}, // app/file262.js
+    {78, 12, 768, 236, 236, 0, false, false}, // app/file6.js
+    {2200, 14, 25872, 109, 109, 0, false, false}, // app/file154.js
+    {4285, 14, 50000, 222, 222, 0, false, false}, // app/file293.js
+    {4300, 14, 50224, 260, 260, 0, false, false}, // app/file294.js
+    {4030, 14, 47024, 184, 184, 0, false, false}, // app/file276.js
+    {998, 13, 11984, 34, 34, 0, false, false}, // app/file72.js
+    {1795, 14, 21264, 294, 294, 0, false, false}, // app/file127.js
+    {270, 13, 2992, 174, 174, 0, false, false}, // app/file20.js
+    {3130, 14, 36880, 35, 35, 0, false, false}, // app/file216.js
+    {1465, 14, 17440, 72, 72, 0, false, false}, // app/file105.js
+    {2770, 14, 32704, 35, 35, 0, false, false}, // app/file192.js
+    {1750, 14, 20576, 183, 183, 0, false, false}, // app/file124.js
+    {2890, 14, 34096, 35, 35, 0, false, false}, // app/file200.js
+    {3220, 14, 37696, 259, 259, 0, false, false}, // app/file222.js
+    {3595, 14, 42144, 297, 297, 0, false, false}, // app/file247.js
+    {3910, 14, 45632, 184, 184, 0, false, false}, // app/file268.js
+    {1780, 14, 20992, 257, 257, 0, false, false}, // app/file126.js
+    {4015, 14, 46864, 146, 146, 0, false, false}, // app/file275.js
+    {3355, 14, 39360, 297, 297, 0, false, false}, // app/file231.js
+    {3430, 14, 40064, 183, 183, 0, false, false}, // app/file236.js
+    {3025, 14, 35536, 72, 72, 0, false, false}, // app/file209.js
+    {1810, 14, 21568, 35, 35, 0, false, false}, // app/file128.js
+    {228, 13, 2656, 69, 69, 0, false, false}, // app/file17.js
+    {410, 13, 4720, 247, 247, 0, false, false}, // app/file30.js
+    {508, 13, 5840, 212, 212, 0, false, false}, // app/file37.js
+    {4165, 14, 48608, 222, 222, 0, false, false}, // app/file285.js
+    {956, 13, 11216, 213, 213, 0, false, false}, // app/file69.js
+    {2680, 14, 31440, 109, 109, 0, false, false}, // app/file186.js
+    {2455, 14, 28768, 146, 146, 0, false, false}, // app/file171.js
+    {914, 13, 10768, 105, 105, 0, false, false}, // app/file66.js
+    {3175, 14, 37120, 146, 146, 0, false, false}, // app/file219.js
+    {2560, 14, 30048, 109, 109, 0, false, false}, // app/file178.js
+    {1825, 14, 21616, 72, 72, 0, false, false}, // app/file129.js
+    {1138, 13, 13456, 105, 105, 0, false, false}, // app/file82.js
+    {52, 12, 384, 167, 167, 0, false, false}, // app/file4.js
+    {130, 13, 1408, 104, 104, 0, false, false}, // app/file10.js
+    {1975, 14, 23200, 146, 146, 0, false, false}, // app/file139.js
+    {3730, 14, 43840, 35, 35, 0, false, false}, // app/file256.js
+    {3625, 14, 42496, 72, 72, 0, false, false}, // app/file249.js
+    {1435, 14, 17088, 294, 294, 0, false, false}, // app/file103.js
+    {2920, 14, 34224, 109, 109, 0, false, false}, // app/file202.js
+    {3115, 14, 36576, 297, 297, 0, false, false}, // app/file215.js
+    {91, 12, 1008, 270, 270, 0, false, false}, // app/file7.js
+    {466, 13, 5392, 104, 104, 0, false, false}, // app/file34.js
+    {104, 12, 1280, 33, 33, 0, false, false}, // app/file8.js
+    {2695, 14, 31552, 146, 146, 0, false, false}, // app/file187.js
+    {256, 13, 2848, 139, 139, 0, false, false}, // app/file19.js
+    {1600, 14, 18912, 109, 109, 0, false, false}, // app/file114.js
+    {858, 13, 10096, 249, 249, 0, false, false}, // app/file62.js
+    {4060, 14, 47440, 260, 260, 0, false, false}, // app/file278.js
+    {886, 13, 10640, 34, 34, 0, false, false}, // app/file64.js
+    {3640, 14, 42576, 109, 109, 0, false, false}, // app/file250.js
+    {214, 13, 2608, 34, 34, 0, false, false}, // app/file16.js
+    {3160, 14, 37008, 109, 109, 0, false, false}, // app/file218.js
+    {578, 13, 6736, 104, 104, 0, false, false}, // app/file42.js
+    {2620, 14, 30736, 258, 258, 0, false, false}, // app/file182.js
+    {2725, 14, 31904, 220, 220, 0, false, false}, // app/file189.js
+    {1166, 13, 13712, 177, 177, 0, false, false}, // app/file84.js
+    {1585, 14, 18832, 72, 72, 0, false, false}, // app/file113.js
+    {1630, 14, 19184, 183, 183, 0, false, false}, // app/file116.js
+    {494, 13, 5648, 176, 176, 0, false, false}, // app/file36.js
+    {2320, 14, 27264, 109, 109, 0, false, false}, // app/file162.js
+    {1306, 13, 15472, 249, 249, 0, false, false}, // app/file94.js
+    {3715, 14, 43536, 298, 298, 0, false, false}, // app/file255.js
+    {648, 13, 7664, 284, 284, 0, false, false}, // app/file47.js
+    {3400, 14, 39792, 109, 109, 0, false, false}, // app/file234.js
+    {1278, 13, 15056, 177, 177, 0, false, false}, // app/file92.js
+    {1870, 14, 21968, 183, 183, 0, false, false}, // app/file132.js
+    {2290, 14, 27136, 35, 35, 0, false, false}, // app/file160.js
+    {284, 13, 3168, 210, 210, 0, false, false}, // app/file21.js
+    {3655, 14, 42688, 146, 146, 0, false, false}, // app/file251.js
+    {3925, 14, 45824, 222, 222, 0, false, false}, // app/file269.js
+    {1376, 13, 16256, 141, 141, 0, false, false}, // app/file99.js
+    {4045, 14, 47216, 222, 222, 0, false, false}, // app/file277.js
+    {1705, 14, 20224, 72, 72, 0, false, false}, // app/file121.js
+    {830, 13, 9680, 177, 177, 0, false, false}, // app/file60.js
+    {4120, 14, 48144, 109, 109, 0, false, false}, // app/file282.js
+    {704, 13, 8192, 141, 141, 0, false, false}, // app/file51.js
+    {1840, 14, 21696, 109, 109, 0, false, false}, // app/file130.js
+    {1945, 14, 23008, 72, 72, 0, false, false}, // app/file137.js
+    {3760, 14, 43968, 109, 109, 0, false, false}, // app/file258.js
+    {2860, 14, 33520, 258, 258, 0, false, false}, // app/file198.js
+    {2140, 14, 25168, 257, 257, 0, false, false}, // app/file150.js
+    {4210, 14, 49408, 35, 35, 0, false, false}, // app/file288.js
+    {117, 12, 1328, 66, 66, 0, false, false}, // app/file9.js
+    {4135, 14, 48256, 146, 146, 0, false, false}, // app/file283.js
+    {3970, 14, 46624, 35, 35, 0, false, false}, // app/file272.js
+    {2875, 14, 33792, 296, 296, 0, false, false}, // app/file199.js
+    {1405, 14, 16592, 220, 220, 0, false, false}, // app/file101.js
+    {844, 13, 9872, 213, 213, 0, false, false}, // app/file61.js
+    {802, 13, 9424, 105, 105, 0, false, false}, // app/file58.js
+    {2110, 14, 24752, 183, 183, 0, false, false}, // app/file148.js
+    {13, 12, 48, 66, 66, 0, false, false}, // app/file1.js
+    {3100, 14, 36304, 259, 259, 0, false, false}, // app/file214.js
+    {3685, 14, 43040, 222, 222, 0, false, false}, // app/file253.js
+    {3580, 14, 41872, 259, 259, 0, false, false}, // app/file246.js
+    {3850, 14, 45232, 35, 35, 0, false, false}, // app/file264.js
+    {4330, 14, 50800, 35, 35, 0, false, false}, // app/file296.js
+    {1096, 13, 13040, 285, 285, 0, false, false}, // app/file79.js
+    {3415, 14, 39904, 146, 146, 0, false, false}, // app/file235.js
+    {662, 13, 7952, 34, 34, 0, false, false}, // app/file48.js
+    {3325, 14, 38864, 221, 221, 0, false, false}, // app/file229.js
+    {3085, 14, 36080, 221, 221, 0, false, false}, // app/file213.js
+    {2635, 14, 31008, 296, 296, 0, false, false}, // app/file183.js
+    {3235, 14, 37968, 297, 297, 0, false, false}, // app/file223.js
+    {1124, 13, 13376, 69, 69, 0, false, false}, // app/file81.js
+    {2095, 14, 24592, 146, 146, 0, false, false}, // app/file147.js
+    {1480, 14, 17520, 109, 109, 0, false, false}, // app/file106.js
+    {564, 13, 6656, 69, 69, 0, false, false}, // app/file41.js
+    {522, 13, 6064, 248, 248, 0, false, false}, // app/file38.js
+    {2815, 14, 32944, 146, 146, 0, false, false}, // app/file195.js
+    {4270, 14, 49808, 184, 184, 0, false, false}, // app/file292.js
+    {1720, 14, 20304, 109, 109, 0, false, false}, // app/file122.js
+    {2035, 14, 24048, 295, 295, 0, false, false}, // app/file143.js
+    {1690, 14, 20176, 35, 35, 0, false, false}, // app/file120.js
+    {592, 13, 6848, 140, 140, 0, false, false}, // app/file43.js
+    {1615, 14, 19024, 146, 146, 0, false, false}, // app/file115.js
+    {1735, 14, 20416, 146, 146, 0, false, false}, // app/file123.js
+    {550, 13, 6608, 34, 34, 0, false, false}, // app/file40.js
+    {3565, 14, 41648, 221, 221, 0, false, false}, // app/file245.js
+    {2740, 14, 32128, 258, 258, 0, false, false}, // app/file190.js
+    {2800, 14, 32832, 109, 109, 0, false, false}, // app/file194.js
+    {3250, 14, 38272, 35, 35, 0, false, false}, // app/file224.js
+    {1054, 13, 12368, 177, 177, 0, false, false}, // app/file76.js
+    {396, 13, 4496, 211, 211, 0, false, false}, // app/file29.js
+    {1320, 13, 15728, 285, 285, 0, false, false}, // app/file95.js
+    {2020, 14, 23776, 257, 257, 0, false, false}, // app/file142.js
+    {2425, 14, 28576, 72, 72, 0, false, false}, // app/file169.js
+    {2470, 14, 28928, 183, 183, 0, false, false}, // app/file172.js
+    {2365, 14, 27728, 220, 220, 0, false, false}, // app/file165.js
+    {788, 13, 9344, 69, 69, 0, false, false}, // app/file57.js
+    {2830, 14, 33104, 183, 183, 0, false, false}, // app/file196.js
+    {2410, 14, 28528, 35, 35, 0, false, false}, // app/file168.js
+    {3880, 14, 45360, 109, 109, 0, false, false}, // app/file266.js
+    {2230, 14, 26144, 183, 183, 0, false, false}, // app/file156.js
+    {3280, 14, 38400, 109, 109, 0, false, false}, // app/file226.js
+    {2350, 14, 27536, 183, 183, 0, false, false}, // app/file164.js
+    {2545, 14, 29968, 72, 72, 0, false, false}, // app/file177.js
+    {2335, 14, 27376, 146, 146, 0, false, false}, // app/file163.js
+    {26, 12, 128, 99, 99, 0, false, false}, // app/file2.js
+    {2530, 14, 29920, 35, 35, 0, false, false}, // app/file176.js
+    {4105, 14, 48064, 72, 72, 0, false, false}, // app/file281.js
+    {2185, 14, 25792, 72, 72, 0, false, false}, // app/file153.js
+    {298, 13, 3392, 246, 246, 0, false, false}, // app/file22.js
+    {1334, 13, 16016, 34, 34, 0, false, false}, // app/file96.js
+    {774, 13, 9296, 34, 34, 0, false, false}, // app/file56.js
+    {3835, 14, 44928, 298, 298, 0, false, false}, // app/file263.js
+    {2395, 14, 28224, 296, 296, 0, false, false}, // app/file167.js
+    {1110, 13, 13328, 34, 34, 0, false, false}, // app/file80.js
+    {4150, 14, 48416, 184, 184, 0, false, false}, // app/file284.js
+    {424, 13, 4976, 283, 283, 0, false, false}, // app/file31.js
+    {158, 13, 1664, 174, 174, 0, false, false}, // app/file12.js
+    {3070, 14, 35888, 183, 183, 0, false, false}, // app/file212.js
+    {3205, 14, 37472, 221, 221, 0, false, false}, // app/file221.js
+    {816, 13, 9536, 141, 141, 0, false, false}, // app/file59.js
+    {634, 13, 7408, 248, 248, 0, false, false}, // app/file46.js
+    {3745, 14, 43888, 72, 72, 0, false, false}, // app/file257.js
+    {3775, 14, 44080, 146, 146, 0, false, false}, // app/file259.js
+    {1900, 14, 22384, 257, 257, 0, false, false}, // app/file134.js
+    {2710, 14, 31712, 183, 183, 0, false, false}, // app/file188.js
+    {3445, 14, 40256, 221, 221, 0, false, false}, // app/file237.js
+    {2575, 14, 30160, 146, 146, 0, false, false}, // app/file179.js
+    {0, 0, 0, 0, 0, 0, false, false}
+};
+
+constexpr std::uint32_t seeds[] = {
+    10, 1, 398, 7, 21, 2, 49, 238, 447, 9, 58, 68, 650, 103, 9, 135,
+    22, 7, 3, 5, 87, 1, 1, 5, 8, 67, 2, 33, 2, 134, 319, 2,
+    2, 1013, 3, 362, 368, 59, 9, 4, 8, 54, 518, 30, 574, 2739, 0, 3284,
+    1, 1, 6, 109, 14, 2132, 112, 40, 389, 108, 4567, 6, 640, 188, 10, 0,
+    25, 5, 1418, 1371, 1, 32, 20, 15, 58, 216, 565,
+    0
+};
+} // namespace
+
+extern const s::wui::packed_assets assets = {blob, paths, mimes, entries, 300, seeds, 75};
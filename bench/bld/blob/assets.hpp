@@ -0,0 +1,2 @@
+#include "wui.hpp"
+extern const s::wui::packed_assets assets;
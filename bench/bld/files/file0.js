@@ -0,0 +1 @@
+/* asset 0 line 0 */ var x0 = 0;
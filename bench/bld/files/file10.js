@@ -0,0 +1,3 @@
+/* asset 10 line 0 */ var x0 = 0;
+/* asset 10 line 1 */ var x1 = 10;
+/* asset 10 line 2 */ var x2 = 20;
@@ -0,0 +1,5 @@
+/* asset 100 line 0 */ var x0 = 0;
+/* asset 100 line 1 */ var x1 = 100;
+/* asset 100 line 2 */ var x2 = 200;
+/* asset 100 line 3 */ var x3 = 300;
+/* asset 100 line 4 */ var x4 = 400;
@@ -0,0 +1,6 @@
+/* asset 101 line 0 */ var x0 = 0;
+/* asset 101 line 1 */ var x1 = 101;
+/* asset 101 line 2 */ var x2 = 202;
+/* asset 101 line 3 */ var x3 = 303;
+/* asset 101 line 4 */ var x4 = 404;
+/* asset 101 line 5 */ var x5 = 505;
@@ -0,0 +1,7 @@
+/* asset 102 line 0 */ var x0 = 0;
+/* asset 102 line 1 */ var x1 = 102;
+/* asset 102 line 2 */ var x2 = 204;
+/* asset 102 line 3 */ var x3 = 306;
+/* asset 102 line 4 */ var x4 = 408;
+/* asset 102 line 5 */ var x5 = 510;
+/* asset 102 line 6 */ var x6 = 612;
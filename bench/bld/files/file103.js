@@ -0,0 +1,8 @@
+/* asset 103 line 0 */ var x0 = 0;
+/* asset 103 line 1 */ var x1 = 103;
+/* asset 103 line 2 */ var x2 = 206;
+/* asset 103 line 3 */ var x3 = 309;
+/* asset 103 line 4 */ var x4 = 412;
+/* asset 103 line 5 */ var x5 = 515;
+/* asset 103 line 6 */ var x6 = 618;
+/* asset 103 line 7 */ var x7 = 721;
@@ -0,0 +1 @@
+/* asset 104 line 0 */ var x0 = 0;
@@ -0,0 +1,3 @@
+/* asset 106 line 0 */ var x0 = 0;
+/* asset 106 line 1 */ var x1 = 106;
+/* asset 106 line 2 */ var x2 = 212;
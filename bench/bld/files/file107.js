@@ -0,0 +1,4 @@
+/* asset 107 line 0 */ var x0 = 0;
+/* asset 107 line 1 */ var x1 = 107;
+/* asset 107 line 2 */ var x2 = 214;
+/* asset 107 line 3 */ var x3 = 321;
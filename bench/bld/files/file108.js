@@ -0,0 +1,5 @@
+/* asset 108 line 0 */ var x0 = 0;
+/* asset 108 line 1 */ var x1 = 108;
+/* asset 108 line 2 */ var x2 = 216;
+/* asset 108 line 3 */ var x3 = 324;
+/* asset 108 line 4 */ var x4 = 432;
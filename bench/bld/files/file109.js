@@ -0,0 +1,6 @@
+/* asset 109 line 0 */ var x0 = 0;
+/* asset 109 line 1 */ var x1 = 109;
+/* asset 109 line 2 */ var x2 = 218;
+/* asset 109 line 3 */ var x3 = 327;
+/* asset 109 line 4 */ var x4 = 436;
+/* asset 109 line 5 */ var x5 = 545;
@@ -0,0 +1,4 @@
+/* asset 11 line 0 */ var x0 = 0;
+/* asset 11 line 1 */ var x1 = 11;
+/* asset 11 line 2 */ var x2 = 22;
+/* asset 11 line 3 */ var x3 = 33;
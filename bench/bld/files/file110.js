@@ -0,0 +1,7 @@
+/* asset 110 line 0 */ var x0 = 0;
+/* asset 110 line 1 */ var x1 = 110;
+/* asset 110 line 2 */ var x2 = 220;
+/* asset 110 line 3 */ var x3 = 330;
+/* asset 110 line 4 */ var x4 = 440;
+/* asset 110 line 5 */ var x5 = 550;
+/* asset 110 line 6 */ var x6 = 660;
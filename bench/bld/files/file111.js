@@ -0,0 +1,8 @@
+/* asset 111 line 0 */ var x0 = 0;
+/* asset 111 line 1 */ var x1 = 111;
+/* asset 111 line 2 */ var x2 = 222;
+/* asset 111 line 3 */ var x3 = 333;
+/* asset 111 line 4 */ var x4 = 444;
+/* asset 111 line 5 */ var x5 = 555;
+/* asset 111 line 6 */ var x6 = 666;
+/* asset 111 line 7 */ var x7 = 777;
@@ -0,0 +1 @@
+/* asset 112 line 0 */ var x0 = 0;
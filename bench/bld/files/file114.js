@@ -0,0 +1,3 @@
+/* asset 114 line 0 */ var x0 = 0;
+/* asset 114 line 1 */ var x1 = 114;
+/* asset 114 line 2 */ var x2 = 228;
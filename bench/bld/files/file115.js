@@ -0,0 +1,4 @@
+/* asset 115 line 0 */ var x0 = 0;
+/* asset 115 line 1 */ var x1 = 115;
+/* asset 115 line 2 */ var x2 = 230;
+/* asset 115 line 3 */ var x3 = 345;
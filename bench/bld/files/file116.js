@@ -0,0 +1,5 @@
+/* asset 116 line 0 */ var x0 = 0;
+/* asset 116 line 1 */ var x1 = 116;
+/* asset 116 line 2 */ var x2 = 232;
+/* asset 116 line 3 */ var x3 = 348;
+/* asset 116 line 4 */ var x4 = 464;
@@ -0,0 +1,6 @@
+/* asset 117 line 0 */ var x0 = 0;
+/* asset 117 line 1 */ var x1 = 117;
+/* asset 117 line 2 */ var x2 = 234;
+/* asset 117 line 3 */ var x3 = 351;
+/* asset 117 line 4 */ var x4 = 468;
+/* asset 117 line 5 */ var x5 = 585;
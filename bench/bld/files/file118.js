@@ -0,0 +1,7 @@
+/* asset 118 line 0 */ var x0 = 0;
+/* asset 118 line 1 */ var x1 = 118;
+/* asset 118 line 2 */ var x2 = 236;
+/* asset 118 line 3 */ var x3 = 354;
+/* asset 118 line 4 */ var x4 = 472;
+/* asset 118 line 5 */ var x5 = 590;
+/* asset 118 line 6 */ var x6 = 708;
@@ -0,0 +1,8 @@
+/* asset 119 line 0 */ var x0 = 0;
+/* asset 119 line 1 */ var x1 = 119;
+/* asset 119 line 2 */ var x2 = 238;
+/* asset 119 line 3 */ var x3 = 357;
+/* asset 119 line 4 */ var x4 = 476;
+/* asset 119 line 5 */ var x5 = 595;
+/* asset 119 line 6 */ var x6 = 714;
+/* asset 119 line 7 */ var x7 = 833;
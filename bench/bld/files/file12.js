@@ -0,0 +1,5 @@
+/* asset 12 line 0 */ var x0 = 0;
+/* asset 12 line 1 */ var x1 = 12;
+/* asset 12 line 2 */ var x2 = 24;
+/* asset 12 line 3 */ var x3 = 36;
+/* asset 12 line 4 */ var x4 = 48;
@@ -0,0 +1 @@
+/* asset 120 line 0 */ var x0 = 0;
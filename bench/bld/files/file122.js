@@ -0,0 +1,3 @@
+/* asset 122 line 0 */ var x0 = 0;
+/* asset 122 line 1 */ var x1 = 122;
+/* asset 122 line 2 */ var x2 = 244;
@@ -0,0 +1,4 @@
+/* asset 123 line 0 */ var x0 = 0;
+/* asset 123 line 1 */ var x1 = 123;
+/* asset 123 line 2 */ var x2 = 246;
+/* asset 123 line 3 */ var x3 = 369;
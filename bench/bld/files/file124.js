@@ -0,0 +1,5 @@
+/* asset 124 line 0 */ var x0 = 0;
+/* asset 124 line 1 */ var x1 = 124;
+/* asset 124 line 2 */ var x2 = 248;
+/* asset 124 line 3 */ var x3 = 372;
+/* asset 124 line 4 */ var x4 = 496;
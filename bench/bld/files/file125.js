@@ -0,0 +1,6 @@
+/* asset 125 line 0 */ var x0 = 0;
+/* asset 125 line 1 */ var x1 = 125;
+/* asset 125 line 2 */ var x2 = 250;
+/* asset 125 line 3 */ var x3 = 375;
+/* asset 125 line 4 */ var x4 = 500;
+/* asset 125 line 5 */ var x5 = 625;
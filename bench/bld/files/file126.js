@@ -0,0 +1,7 @@
+/* asset 126 line 0 */ var x0 = 0;
+/* asset 126 line 1 */ var x1 = 126;
+/* asset 126 line 2 */ var x2 = 252;
+/* asset 126 line 3 */ var x3 = 378;
+/* asset 126 line 4 */ var x4 = 504;
+/* asset 126 line 5 */ var x5 = 630;
+/* asset 126 line 6 */ var x6 = 756;
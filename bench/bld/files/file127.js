@@ -0,0 +1,8 @@
+/* asset 127 line 0 */ var x0 = 0;
+/* asset 127 line 1 */ var x1 = 127;
+/* asset 127 line 2 */ var x2 = 254;
+/* asset 127 line 3 */ var x3 = 381;
+/* asset 127 line 4 */ var x4 = 508;
+/* asset 127 line 5 */ var x5 = 635;
+/* asset 127 line 6 */ var x6 = 762;
+/* asset 127 line 7 */ var x7 = 889;
@@ -0,0 +1 @@
+/* asset 128 line 0 */ var x0 = 0;
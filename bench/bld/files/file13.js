@@ -0,0 +1,6 @@
+/* asset 13 line 0 */ var x0 = 0;
+/* asset 13 line 1 */ var x1 = 13;
+/* asset 13 line 2 */ var x2 = 26;
+/* asset 13 line 3 */ var x3 = 39;
+/* asset 13 line 4 */ var x4 = 52;
+/* asset 13 line 5 */ var x5 = 65;
@@ -0,0 +1,3 @@
+/* asset 130 line 0 */ var x0 = 0;
+/* asset 130 line 1 */ var x1 = 130;
+/* asset 130 line 2 */ var x2 = 260;
@@ -0,0 +1,4 @@
+/* asset 131 line 0 */ var x0 = 0;
+/* asset 131 line 1 */ var x1 = 131;
+/* asset 131 line 2 */ var x2 = 262;
+/* asset 131 line 3 */ var x3 = 393;
@@ -0,0 +1,5 @@
+/* asset 132 line 0 */ var x0 = 0;
+/* asset 132 line 1 */ var x1 = 132;
+/* asset 132 line 2 */ var x2 = 264;
+/* asset 132 line 3 */ var x3 = 396;
+/* asset 132 line 4 */ var x4 = 528;
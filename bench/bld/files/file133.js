@@ -0,0 +1,6 @@
+/* asset 133 line 0 */ var x0 = 0;
+/* asset 133 line 1 */ var x1 = 133;
+/* asset 133 line 2 */ var x2 = 266;
+/* asset 133 line 3 */ var x3 = 399;
+/* asset 133 line 4 */ var x4 = 532;
+/* asset 133 line 5 */ var x5 = 665;
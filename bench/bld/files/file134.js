@@ -0,0 +1,7 @@
+/* asset 134 line 0 */ var x0 = 0;
+/* asset 134 line 1 */ var x1 = 134;
+/* asset 134 line 2 */ var x2 = 268;
+/* asset 134 line 3 */ var x3 = 402;
+/* asset 134 line 4 */ var x4 = 536;
+/* asset 134 line 5 */ var x5 = 670;
+/* asset 134 line 6 */ var x6 = 804;
@@ -0,0 +1,8 @@
+/* asset 135 line 0 */ var x0 = 0;
+/* asset 135 line 1 */ var x1 = 135;
+/* asset 135 line 2 */ var x2 = 270;
+/* asset 135 line 3 */ var x3 = 405;
+/* asset 135 line 4 */ var x4 = 540;
+/* asset 135 line 5 */ var x5 = 675;
+/* asset 135 line 6 */ var x6 = 810;
+/* asset 135 line 7 */ var x7 = 945;
@@ -0,0 +1 @@
+/* asset 136 line 0 */ var x0 = 0;
@@ -0,0 +1,3 @@
+/* asset 138 line 0 */ var x0 = 0;
+/* asset 138 line 1 */ var x1 = 138;
+/* asset 138 line 2 */ var x2 = 276;
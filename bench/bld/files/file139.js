@@ -0,0 +1,4 @@
+/* asset 139 line 0 */ var x0 = 0;
+/* asset 139 line 1 */ var x1 = 139;
+/* asset 139 line 2 */ var x2 = 278;
+/* asset 139 line 3 */ var x3 = 417;
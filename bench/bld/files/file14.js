@@ -0,0 +1,7 @@
+/* asset 14 line 0 */ var x0 = 0;
+/* asset 14 line 1 */ var x1 = 14;
+/* asset 14 line 2 */ var x2 = 28;
+/* asset 14 line 3 */ var x3 = 42;
+/* asset 14 line 4 */ var x4 = 56;
+/* asset 14 line 5 */ var x5 = 70;
+/* asset 14 line 6 */ var x6 = 84;
@@ -0,0 +1,5 @@
+/* asset 140 line 0 */ var x0 = 0;
+/* asset 140 line 1 */ var x1 = 140;
+/* asset 140 line 2 */ var x2 = 280;
+/* asset 140 line 3 */ var x3 = 420;
+/* asset 140 line 4 */ var x4 = 560;
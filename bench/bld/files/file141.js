@@ -0,0 +1,6 @@
+/* asset 141 line 0 */ var x0 = 0;
+/* asset 141 line 1 */ var x1 = 141;
+/* asset 141 line 2 */ var x2 = 282;
+/* asset 141 line 3 */ var x3 = 423;
+/* asset 141 line 4 */ var x4 = 564;
+/* asset 141 line 5 */ var x5 = 705;
@@ -0,0 +1,7 @@
+/* asset 142 line 0 */ var x0 = 0;
+/* asset 142 line 1 */ var x1 = 142;
+/* asset 142 line 2 */ var x2 = 284;
+/* asset 142 line 3 */ var x3 = 426;
+/* asset 142 line 4 */ var x4 = 568;
+/* asset 142 line 5 */ var x5 = 710;
+/* asset 142 line 6 */ var x6 = 852;
@@ -0,0 +1,8 @@
+/* asset 143 line 0 */ var x0 = 0;
+/* asset 143 line 1 */ var x1 = 143;
+/* asset 143 line 2 */ var x2 = 286;
+/* asset 143 line 3 */ var x3 = 429;
+/* asset 143 line 4 */ var x4 = 572;
+/* asset 143 line 5 */ var x5 = 715;
+/* asset 143 line 6 */ var x6 = 858;
+/* asset 143 line 7 */ var x7 = 1001;
@@ -0,0 +1 @@
+/* asset 144 line 0 */ var x0 = 0;
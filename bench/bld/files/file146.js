@@ -0,0 +1,3 @@
+/* asset 146 line 0 */ var x0 = 0;
+/* asset 146 line 1 */ var x1 = 146;
+/* asset 146 line 2 */ var x2 = 292;
@@ -0,0 +1,4 @@
+/* asset 147 line 0 */ var x0 = 0;
+/* asset 147 line 1 */ var x1 = 147;
+/* asset 147 line 2 */ var x2 = 294;
+/* asset 147 line 3 */ var x3 = 441;
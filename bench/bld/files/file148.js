@@ -0,0 +1,5 @@
+/* asset 148 line 0 */ var x0 = 0;
+/* asset 148 line 1 */ var x1 = 148;
+/* asset 148 line 2 */ var x2 = 296;
+/* asset 148 line 3 */ var x3 = 444;
+/* asset 148 line 4 */ var x4 = 592;
@@ -0,0 +1,6 @@
+/* asset 149 line 0 */ var x0 = 0;
+/* asset 149 line 1 */ var x1 = 149;
+/* asset 149 line 2 */ var x2 = 298;
+/* asset 149 line 3 */ var x3 = 447;
+/* asset 149 line 4 */ var x4 = 596;
+/* asset 149 line 5 */ var x5 = 745;
@@ -0,0 +1,8 @@
+/* asset 15 line 0 */ var x0 = 0;
+/* asset 15 line 1 */ var x1 = 15;
+/* asset 15 line 2 */ var x2 = 30;
+/* asset 15 line 3 */ var x3 = 45;
+/* asset 15 line 4 */ var x4 = 60;
+/* asset 15 line 5 */ var x5 = 75;
+/* asset 15 line 6 */ var x6 = 90;
+/* asset 15 line 7 */ var x7 = 105;
@@ -0,0 +1,7 @@
+/* asset 150 line 0 */ var x0 = 0;
+/* asset 150 line 1 */ var x1 = 150;
+/* asset 150 line 2 */ var x2 = 300;
+/* asset 150 line 3 */ var x3 = 450;
+/* asset 150 line 4 */ var x4 = 600;
+/* asset 150 line 5 */ var x5 = 750;
+/* asset 150 line 6 */ var x6 = 900;
@@ -0,0 +1,8 @@
+/* asset 151 line 0 */ var x0 = 0;
+/* asset 151 line 1 */ var x1 = 151;
+/* asset 151 line 2 */ var x2 = 302;
+/* asset 151 line 3 */ var x3 = 453;
+/* asset 151 line 4 */ var x4 = 604;
+/* asset 151 line 5 */ var x5 = 755;
+/* asset 151 line 6 */ var x6 = 906;
+/* asset 151 line 7 */ var x7 = 1057;
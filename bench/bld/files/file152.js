@@ -0,0 +1 @@
+/* asset 152 line 0 */ var x0 = 0;
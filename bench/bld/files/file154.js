@@ -0,0 +1,3 @@
+/* asset 154 line 0 */ var x0 = 0;
+/* asset 154 line 1 */ var x1 = 154;
+/* asset 154 line 2 */ var x2 = 308;
@@ -0,0 +1,4 @@
+/* asset 155 line 0 */ var x0 = 0;
+/* asset 155 line 1 */ var x1 = 155;
+/* asset 155 line 2 */ var x2 = 310;
+/* asset 155 line 3 */ var x3 = 465;
@@ -0,0 +1,5 @@
+/* asset 156 line 0 */ var x0 = 0;
+/* asset 156 line 1 */ var x1 = 156;
+/* asset 156 line 2 */ var x2 = 312;
+/* asset 156 line 3 */ var x3 = 468;
+/* asset 156 line 4 */ var x4 = 624;
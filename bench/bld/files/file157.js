@@ -0,0 +1,6 @@
+/* asset 157 line 0 */ var x0 = 0;
+/* asset 157 line 1 */ var x1 = 157;
+/* asset 157 line 2 */ var x2 = 314;
+/* asset 157 line 3 */ var x3 = 471;
+/* asset 157 line 4 */ var x4 = 628;
+/* asset 157 line 5 */ var x5 = 785;
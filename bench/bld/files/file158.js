@@ -0,0 +1,7 @@
+/* asset 158 line 0 */ var x0 = 0;
+/* asset 158 line 1 */ var x1 = 158;
+/* asset 158 line 2 */ var x2 = 316;
+/* asset 158 line 3 */ var x3 = 474;
+/* asset 158 line 4 */ var x4 = 632;
+/* asset 158 line 5 */ var x5 = 790;
+/* asset 158 line 6 */ var x6 = 948;
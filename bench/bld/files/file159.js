@@ -0,0 +1,8 @@
+/* asset 159 line 0 */ var x0 = 0;
+/* asset 159 line 1 */ var x1 = 159;
+/* asset 159 line 2 */ var x2 = 318;
+/* asset 159 line 3 */ var x3 = 477;
+/* asset 159 line 4 */ var x4 = 636;
+/* asset 159 line 5 */ var x5 = 795;
+/* asset 159 line 6 */ var x6 = 954;
+/* asset 159 line 7 */ var x7 = 1113;
@@ -0,0 +1 @@
+/* asset 16 line 0 */ var x0 = 0;
@@ -0,0 +1 @@
+/* asset 160 line 0 */ var x0 = 0;
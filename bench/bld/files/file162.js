@@ -0,0 +1,3 @@
+/* asset 162 line 0 */ var x0 = 0;
+/* asset 162 line 1 */ var x1 = 162;
+/* asset 162 line 2 */ var x2 = 324;
@@ -0,0 +1,4 @@
+/* asset 163 line 0 */ var x0 = 0;
+/* asset 163 line 1 */ var x1 = 163;
+/* asset 163 line 2 */ var x2 = 326;
+/* asset 163 line 3 */ var x3 = 489;
@@ -0,0 +1,5 @@
+/* asset 164 line 0 */ var x0 = 0;
+/* asset 164 line 1 */ var x1 = 164;
+/* asset 164 line 2 */ var x2 = 328;
+/* asset 164 line 3 */ var x3 = 492;
+/* asset 164 line 4 */ var x4 = 656;
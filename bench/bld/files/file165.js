@@ -0,0 +1,6 @@
+/* asset 165 line 0 */ var x0 = 0;
+/* asset 165 line 1 */ var x1 = 165;
+/* asset 165 line 2 */ var x2 = 330;
+/* asset 165 line 3 */ var x3 = 495;
+/* asset 165 line 4 */ var x4 = 660;
+/* asset 165 line 5 */ var x5 = 825;
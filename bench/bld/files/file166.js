@@ -0,0 +1,7 @@
+/* asset 166 line 0 */ var x0 = 0;
+/* asset 166 line 1 */ var x1 = 166;
+/* asset 166 line 2 */ var x2 = 332;
+/* asset 166 line 3 */ var x3 = 498;
+/* asset 166 line 4 */ var x4 = 664;
+/* asset 166 line 5 */ var x5 = 830;
+/* asset 166 line 6 */ var x6 = 996;
@@ -0,0 +1,8 @@
+/* asset 167 line 0 */ var x0 = 0;
+/* asset 167 line 1 */ var x1 = 167;
+/* asset 167 line 2 */ var x2 = 334;
+/* asset 167 line 3 */ var x3 = 501;
+/* asset 167 line 4 */ var x4 = 668;
+/* asset 167 line 5 */ var x5 = 835;
+/* asset 167 line 6 */ var x6 = 1002;
+/* asset 167 line 7 */ var x7 = 1169;
@@ -0,0 +1 @@
+/* asset 168 line 0 */ var x0 = 0;
@@ -0,0 +1,3 @@
+/* asset 170 line 0 */ var x0 = 0;
+/* asset 170 line 1 */ var x1 = 170;
+/* asset 170 line 2 */ var x2 = 340;
@@ -0,0 +1,4 @@
+/* asset 171 line 0 */ var x0 = 0;
+/* asset 171 line 1 */ var x1 = 171;
+/* asset 171 line 2 */ var x2 = 342;
+/* asset 171 line 3 */ var x3 = 513;
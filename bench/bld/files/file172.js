@@ -0,0 +1,5 @@
+/* asset 172 line 0 */ var x0 = 0;
+/* asset 172 line 1 */ var x1 = 172;
+/* asset 172 line 2 */ var x2 = 344;
+/* asset 172 line 3 */ var x3 = 516;
+/* asset 172 line 4 */ var x4 = 688;
@@ -0,0 +1,6 @@
+/* asset 173 line 0 */ var x0 = 0;
+/* asset 173 line 1 */ var x1 = 173;
+/* asset 173 line 2 */ var x2 = 346;
+/* asset 173 line 3 */ var x3 = 519;
+/* asset 173 line 4 */ var x4 = 692;
+/* asset 173 line 5 */ var x5 = 865;
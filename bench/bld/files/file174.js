@@ -0,0 +1,7 @@
+/* asset 174 line 0 */ var x0 = 0;
+/* asset 174 line 1 */ var x1 = 174;
+/* asset 174 line 2 */ var x2 = 348;
+/* asset 174 line 3 */ var x3 = 522;
+/* asset 174 line 4 */ var x4 = 696;
+/* asset 174 line 5 */ var x5 = 870;
+/* asset 174 line 6 */ var x6 = 1044;
@@ -0,0 +1,8 @@
+/* asset 175 line 0 */ var x0 = 0;
+/* asset 175 line 1 */ var x1 = 175;
+/* asset 175 line 2 */ var x2 = 350;
+/* asset 175 line 3 */ var x3 = 525;
+/* asset 175 line 4 */ var x4 = 700;
+/* asset 175 line 5 */ var x5 = 875;
+/* asset 175 line 6 */ var x6 = 1050;
+/* asset 175 line 7 */ var x7 = 1225;
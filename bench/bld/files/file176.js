@@ -0,0 +1 @@
+/* asset 176 line 0 */ var x0 = 0;
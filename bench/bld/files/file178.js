@@ -0,0 +1,3 @@
+/* asset 178 line 0 */ var x0 = 0;
+/* asset 178 line 1 */ var x1 = 178;
+/* asset 178 line 2 */ var x2 = 356;
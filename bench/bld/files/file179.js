@@ -0,0 +1,4 @@
+/* asset 179 line 0 */ var x0 = 0;
+/* asset 179 line 1 */ var x1 = 179;
+/* asset 179 line 2 */ var x2 = 358;
+/* asset 179 line 3 */ var x3 = 537;
@@ -0,0 +1,3 @@
+/* asset 18 line 0 */ var x0 = 0;
+/* asset 18 line 1 */ var x1 = 18;
+/* asset 18 line 2 */ var x2 = 36;
@@ -0,0 +1,5 @@
+/* asset 180 line 0 */ var x0 = 0;
+/* asset 180 line 1 */ var x1 = 180;
+/* asset 180 line 2 */ var x2 = 360;
+/* asset 180 line 3 */ var x3 = 540;
+/* asset 180 line 4 */ var x4 = 720;
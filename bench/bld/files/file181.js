@@ -0,0 +1,6 @@
+/* asset 181 line 0 */ var x0 = 0;
+/* asset 181 line 1 */ var x1 = 181;
+/* asset 181 line 2 */ var x2 = 362;
+/* asset 181 line 3 */ var x3 = 543;
+/* asset 181 line 4 */ var x4 = 724;
+/* asset 181 line 5 */ var x5 = 905;
@@ -0,0 +1,7 @@
+/* asset 182 line 0 */ var x0 = 0;
+/* asset 182 line 1 */ var x1 = 182;
+/* asset 182 line 2 */ var x2 = 364;
+/* asset 182 line 3 */ var x3 = 546;
+/* asset 182 line 4 */ var x4 = 728;
+/* asset 182 line 5 */ var x5 = 910;
+/* asset 182 line 6 */ var x6 = 1092;
@@ -0,0 +1,8 @@
+/* asset 183 line 0 */ var x0 = 0;
+/* asset 183 line 1 */ var x1 = 183;
+/* asset 183 line 2 */ var x2 = 366;
+/* asset 183 line 3 */ var x3 = 549;
+/* asset 183 line 4 */ var x4 = 732;
+/* asset 183 line 5 */ var x5 = 915;
+/* asset 183 line 6 */ var x6 = 1098;
+/* asset 183 line 7 */ var x7 = 1281;
@@ -0,0 +1 @@
+/* asset 184 line 0 */ var x0 = 0;
@@ -0,0 +1,3 @@
+/* asset 186 line 0 */ var x0 = 0;
+/* asset 186 line 1 */ var x1 = 186;
+/* asset 186 line 2 */ var x2 = 372;
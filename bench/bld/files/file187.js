@@ -0,0 +1,4 @@
+/* asset 187 line 0 */ var x0 = 0;
+/* asset 187 line 1 */ var x1 = 187;
+/* asset 187 line 2 */ var x2 = 374;
+/* asset 187 line 3 */ var x3 = 561;
@@ -0,0 +1,5 @@
+/* asset 188 line 0 */ var x0 = 0;
+/* asset 188 line 1 */ var x1 = 188;
+/* asset 188 line 2 */ var x2 = 376;
+/* asset 188 line 3 */ var x3 = 564;
+/* asset 188 line 4 */ var x4 = 752;
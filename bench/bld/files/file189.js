@@ -0,0 +1,6 @@
+/* asset 189 line 0 */ var x0 = 0;
+/* asset 189 line 1 */ var x1 = 189;
+/* asset 189 line 2 */ var x2 = 378;
+/* asset 189 line 3 */ var x3 = 567;
+/* asset 189 line 4 */ var x4 = 756;
+/* asset 189 line 5 */ var x5 = 945;
@@ -0,0 +1,4 @@
+/* asset 19 line 0 */ var x0 = 0;
+/* asset 19 line 1 */ var x1 = 19;
+/* asset 19 line 2 */ var x2 = 38;
+/* asset 19 line 3 */ var x3 = 57;
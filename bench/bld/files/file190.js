@@ -0,0 +1,7 @@
+/* asset 190 line 0 */ var x0 = 0;
+/* asset 190 line 1 */ var x1 = 190;
+/* asset 190 line 2 */ var x2 = 380;
+/* asset 190 line 3 */ var x3 = 570;
+/* asset 190 line 4 */ var x4 = 760;
+/* asset 190 line 5 */ var x5 = 950;
+/* asset 190 line 6 */ var x6 = 1140;
@@ -0,0 +1,8 @@
+/* asset 191 line 0 */ var x0 = 0;
+/* asset 191 line 1 */ var x1 = 191;
+/* asset 191 line 2 */ var x2 = 382;
+/* asset 191 line 3 */ var x3 = 573;
+/* asset 191 line 4 */ var x4 = 764;
+/* asset 191 line 5 */ var x5 = 955;
+/* asset 191 line 6 */ var x6 = 1146;
+/* asset 191 line 7 */ var x7 = 1337;
@@ -0,0 +1 @@
+/* asset 192 line 0 */ var x0 = 0;
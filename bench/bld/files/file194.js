@@ -0,0 +1,3 @@
+/* asset 194 line 0 */ var x0 = 0;
+/* asset 194 line 1 */ var x1 = 194;
+/* asset 194 line 2 */ var x2 = 388;
@@ -0,0 +1,4 @@
+/* asset 195 line 0 */ var x0 = 0;
+/* asset 195 line 1 */ var x1 = 195;
+/* asset 195 line 2 */ var x2 = 390;
+/* asset 195 line 3 */ var x3 = 585;
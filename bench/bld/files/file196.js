@@ -0,0 +1,5 @@
+/* asset 196 line 0 */ var x0 = 0;
+/* asset 196 line 1 */ var x1 = 196;
+/* asset 196 line 2 */ var x2 = 392;
+/* asset 196 line 3 */ var x3 = 588;
+/* asset 196 line 4 */ var x4 = 784;
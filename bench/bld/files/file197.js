@@ -0,0 +1,6 @@
+/* asset 197 line 0 */ var x0 = 0;
+/* asset 197 line 1 */ var x1 = 197;
+/* asset 197 line 2 */ var x2 = 394;
+/* asset 197 line 3 */ var x3 = 591;
+/* asset 197 line 4 */ var x4 = 788;
+/* asset 197 line 5 */ var x5 = 985;
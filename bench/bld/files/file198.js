@@ -0,0 +1,7 @@
+/* asset 198 line 0 */ var x0 = 0;
+/* asset 198 line 1 */ var x1 = 198;
+/* asset 198 line 2 */ var x2 = 396;
+/* asset 198 line 3 */ var x3 = 594;
+/* asset 198 line 4 */ var x4 = 792;
+/* asset 198 line 5 */ var x5 = 990;
+/* asset 198 line 6 */ var x6 = 1188;
@@ -0,0 +1,8 @@
+/* asset 199 line 0 */ var x0 = 0;
+/* asset 199 line 1 */ var x1 = 199;
+/* asset 199 line 2 */ var x2 = 398;
+/* asset 199 line 3 */ var x3 = 597;
+/* asset 199 line 4 */ var x4 = 796;
+/* asset 199 line 5 */ var x5 = 995;
+/* asset 199 line 6 */ var x6 = 1194;
+/* asset 199 line 7 */ var x7 = 1393;
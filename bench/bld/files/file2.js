@@ -0,0 +1,3 @@
+/* asset 2 line 0 */ var x0 = 0;
+/* asset 2 line 1 */ var x1 = 2;
+/* asset 2 line 2 */ var x2 = 4;
@@ -0,0 +1,5 @@
+/* asset 20 line 0 */ var x0 = 0;
+/* asset 20 line 1 */ var x1 = 20;
+/* asset 20 line 2 */ var x2 = 40;
+/* asset 20 line 3 */ var x3 = 60;
+/* asset 20 line 4 */ var x4 = 80;
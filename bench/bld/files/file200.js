@@ -0,0 +1 @@
+/* asset 200 line 0 */ var x0 = 0;
@@ -0,0 +1,3 @@
+/* asset 202 line 0 */ var x0 = 0;
+/* asset 202 line 1 */ var x1 = 202;
+/* asset 202 line 2 */ var x2 = 404;
@@ -0,0 +1,4 @@
+/* asset 203 line 0 */ var x0 = 0;
+/* asset 203 line 1 */ var x1 = 203;
+/* asset 203 line 2 */ var x2 = 406;
+/* asset 203 line 3 */ var x3 = 609;
@@ -0,0 +1,5 @@
+/* asset 204 line 0 */ var x0 = 0;
+/* asset 204 line 1 */ var x1 = 204;
+/* asset 204 line 2 */ var x2 = 408;
+/* asset 204 line 3 */ var x3 = 612;
+/* asset 204 line 4 */ var x4 = 816;
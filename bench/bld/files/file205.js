@@ -0,0 +1,6 @@
+/* asset 205 line 0 */ var x0 = 0;
+/* asset 205 line 1 */ var x1 = 205;
+/* asset 205 line 2 */ var x2 = 410;
+/* asset 205 line 3 */ var x3 = 615;
+/* asset 205 line 4 */ var x4 = 820;
+/* asset 205 line 5 */ var x5 = 1025;
@@ -0,0 +1,7 @@
+/* asset 206 line 0 */ var x0 = 0;
+/* asset 206 line 1 */ var x1 = 206;
+/* asset 206 line 2 */ var x2 = 412;
+/* asset 206 line 3 */ var x3 = 618;
+/* asset 206 line 4 */ var x4 = 824;
+/* asset 206 line 5 */ var x5 = 1030;
+/* asset 206 line 6 */ var x6 = 1236;
@@ -0,0 +1,8 @@
+/* asset 207 line 0 */ var x0 = 0;
+/* asset 207 line 1 */ var x1 = 207;
+/* asset 207 line 2 */ var x2 = 414;
+/* asset 207 line 3 */ var x3 = 621;
+/* asset 207 line 4 */ var x4 = 828;
+/* asset 207 line 5 */ var x5 = 1035;
+/* asset 207 line 6 */ var x6 = 1242;
+/* asset 207 line 7 */ var x7 = 1449;
@@ -0,0 +1 @@
+/* asset 208 line 0 */ var x0 = 0;
@@ -0,0 +1,6 @@
+/* asset 21 line 0 */ var x0 = 0;
+/* asset 21 line 1 */ var x1 = 21;
+/* asset 21 line 2 */ var x2 = 42;
+/* asset 21 line 3 */ var x3 = 63;
+/* asset 21 line 4 */ var x4 = 84;
+/* asset 21 line 5 */ var x5 = 105;
@@ -0,0 +1,3 @@
+/* asset 210 line 0 */ var x0 = 0;
+/* asset 210 line 1 */ var x1 = 210;
+/* asset 210 line 2 */ var x2 = 420;
@@ -0,0 +1,4 @@
+/* asset 211 line 0 */ var x0 = 0;
+/* asset 211 line 1 */ var x1 = 211;
+/* asset 211 line 2 */ var x2 = 422;
+/* asset 211 line 3 */ var x3 = 633;
@@ -0,0 +1,5 @@
+/* asset 212 line 0 */ var x0 = 0;
+/* asset 212 line 1 */ var x1 = 212;
+/* asset 212 line 2 */ var x2 = 424;
+/* asset 212 line 3 */ var x3 = 636;
+/* asset 212 line 4 */ var x4 = 848;
@@ -0,0 +1,6 @@
+/* asset 213 line 0 */ var x0 = 0;
+/* asset 213 line 1 */ var x1 = 213;
+/* asset 213 line 2 */ var x2 = 426;
+/* asset 213 line 3 */ var x3 = 639;
+/* asset 213 line 4 */ var x4 = 852;
+/* asset 213 line 5 */ var x5 = 1065;
@@ -0,0 +1,7 @@
+/* asset 214 line 0 */ var x0 = 0;
+/* asset 214 line 1 */ var x1 = 214;
+/* asset 214 line 2 */ var x2 = 428;
+/* asset 214 line 3 */ var x3 = 642;
+/* asset 214 line 4 */ var x4 = 856;
+/* asset 214 line 5 */ var x5 = 1070;
+/* asset 214 line 6 */ var x6 = 1284;
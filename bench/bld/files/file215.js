@@ -0,0 +1,8 @@
+/* asset 215 line 0 */ var x0 = 0;
+/* asset 215 line 1 */ var x1 = 215;
+/* asset 215 line 2 */ var x2 = 430;
+/* asset 215 line 3 */ var x3 = 645;
+/* asset 215 line 4 */ var x4 = 860;
+/* asset 215 line 5 */ var x5 = 1075;
+/* asset 215 line 6 */ var x6 = 1290;
+/* asset 215 line 7 */ var x7 = 1505;
@@ -0,0 +1 @@
+/* asset 216 line 0 */ var x0 = 0;
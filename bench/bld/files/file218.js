@@ -0,0 +1,3 @@
+/* asset 218 line 0 */ var x0 = 0;
+/* asset 218 line 1 */ var x1 = 218;
+/* asset 218 line 2 */ var x2 = 436;
@@ -0,0 +1,4 @@
+/* asset 219 line 0 */ var x0 = 0;
+/* asset 219 line 1 */ var x1 = 219;
+/* asset 219 line 2 */ var x2 = 438;
+/* asset 219 line 3 */ var x3 = 657;
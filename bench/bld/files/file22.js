@@ -0,0 +1,7 @@
+/* asset 22 line 0 */ var x0 = 0;
+/* asset 22 line 1 */ var x1 = 22;
+/* asset 22 line 2 */ var x2 = 44;
+/* asset 22 line 3 */ var x3 = 66;
+/* asset 22 line 4 */ var x4 = 88;
+/* asset 22 line 5 */ var x5 = 110;
+/* asset 22 line 6 */ var x6 = 132;
@@ -0,0 +1,5 @@
+/* asset 220 line 0 */ var x0 = 0;
+/* asset 220 line 1 */ var x1 = 220;
+/* asset 220 line 2 */ var x2 = 440;
+/* asset 220 line 3 */ var x3 = 660;
+/* asset 220 line 4 */ var x4 = 880;
@@ -0,0 +1,6 @@
+/* asset 221 line 0 */ var x0 = 0;
+/* asset 221 line 1 */ var x1 = 221;
+/* asset 221 line 2 */ var x2 = 442;
+/* asset 221 line 3 */ var x3 = 663;
+/* asset 221 line 4 */ var x4 = 884;
+/* asset 221 line 5 */ var x5 = 1105;
@@ -0,0 +1,7 @@
+/* asset 222 line 0 */ var x0 = 0;
+/* asset 222 line 1 */ var x1 = 222;
+/* asset 222 line 2 */ var x2 = 444;
+/* asset 222 line 3 */ var x3 = 666;
+/* asset 222 line 4 */ var x4 = 888;
+/* asset 222 line 5 */ var x5 = 1110;
+/* asset 222 line 6 */ var x6 = 1332;
@@ -0,0 +1,8 @@
+/* asset 223 line 0 */ var x0 = 0;
+/* asset 223 line 1 */ var x1 = 223;
+/* asset 223 line 2 */ var x2 = 446;
+/* asset 223 line 3 */ var x3 = 669;
+/* asset 223 line 4 */ var x4 = 892;
+/* asset 223 line 5 */ var x5 = 1115;
+/* asset 223 line 6 */ var x6 = 1338;
+/* asset 223 line 7 */ var x7 = 1561;
@@ -0,0 +1 @@
+/* asset 224 line 0 */ var x0 = 0;
@@ -0,0 +1,3 @@
+/* asset 226 line 0 */ var x0 = 0;
+/* asset 226 line 1 */ var x1 = 226;
+/* asset 226 line 2 */ var x2 = 452;
@@ -0,0 +1,4 @@
+/* asset 227 line 0 */ var x0 = 0;
+/* asset 227 line 1 */ var x1 = 227;
+/* asset 227 line 2 */ var x2 = 454;
+/* asset 227 line 3 */ var x3 = 681;
@@ -0,0 +1,5 @@
+/* asset 228 line 0 */ var x0 = 0;
+/* asset 228 line 1 */ var x1 = 228;
+/* asset 228 line 2 */ var x2 = 456;
+/* asset 228 line 3 */ var x3 = 684;
+/* asset 228 line 4 */ var x4 = 912;
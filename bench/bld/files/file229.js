@@ -0,0 +1,6 @@
+/* asset 229 line 0 */ var x0 = 0;
+/* asset 229 line 1 */ var x1 = 229;
+/* asset 229 line 2 */ var x2 = 458;
+/* asset 229 line 3 */ var x3 = 687;
+/* asset 229 line 4 */ var x4 = 916;
+/* asset 229 line 5 */ var x5 = 1145;
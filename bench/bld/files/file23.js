@@ -0,0 +1,8 @@
+/* asset 23 line 0 */ var x0 = 0;
+/* asset 23 line 1 */ var x1 = 23;
+/* asset 23 line 2 */ var x2 = 46;
+/* asset 23 line 3 */ var x3 = 69;
+/* asset 23 line 4 */ var x4 = 92;
+/* asset 23 line 5 */ var x5 = 115;
+/* asset 23 line 6 */ var x6 = 138;
+/* asset 23 line 7 */ var x7 = 161;
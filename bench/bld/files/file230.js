@@ -0,0 +1,7 @@
+/* asset 230 line 0 */ var x0 = 0;
+/* asset 230 line 1 */ var x1 = 230;
+/* asset 230 line 2 */ var x2 = 460;
+/* asset 230 line 3 */ var x3 = 690;
+/* asset 230 line 4 */ var x4 = 920;
+/* asset 230 line 5 */ var x5 = 1150;
+/* asset 230 line 6 */ var x6 = 1380;
@@ -0,0 +1,8 @@
+/* asset 231 line 0 */ var x0 = 0;
+/* asset 231 line 1 */ var x1 = 231;
+/* asset 231 line 2 */ var x2 = 462;
+/* asset 231 line 3 */ var x3 = 693;
+/* asset 231 line 4 */ var x4 = 924;
+/* asset 231 line 5 */ var x5 = 1155;
+/* asset 231 line 6 */ var x6 = 1386;
+/* asset 231 line 7 */ var x7 = 1617;
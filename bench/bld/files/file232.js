@@ -0,0 +1 @@
+/* asset 232 line 0 */ var x0 = 0;
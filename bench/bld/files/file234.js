@@ -0,0 +1,3 @@
+/* asset 234 line 0 */ var x0 = 0;
+/* asset 234 line 1 */ var x1 = 234;
+/* asset 234 line 2 */ var x2 = 468;
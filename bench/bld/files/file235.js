@@ -0,0 +1,4 @@
+/* asset 235 line 0 */ var x0 = 0;
+/* asset 235 line 1 */ var x1 = 235;
+/* asset 235 line 2 */ var x2 = 470;
+/* asset 235 line 3 */ var x3 = 705;
@@ -0,0 +1,5 @@
+/* asset 236 line 0 */ var x0 = 0;
+/* asset 236 line 1 */ var x1 = 236;
+/* asset 236 line 2 */ var x2 = 472;
+/* asset 236 line 3 */ var x3 = 708;
+/* asset 236 line 4 */ var x4 = 944;
@@ -0,0 +1,6 @@
+/* asset 237 line 0 */ var x0 = 0;
+/* asset 237 line 1 */ var x1 = 237;
+/* asset 237 line 2 */ var x2 = 474;
+/* asset 237 line 3 */ var x3 = 711;
+/* asset 237 line 4 */ var x4 = 948;
+/* asset 237 line 5 */ var x5 = 1185;
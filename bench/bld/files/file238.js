@@ -0,0 +1,7 @@
+/* asset 238 line 0 */ var x0 = 0;
+/* asset 238 line 1 */ var x1 = 238;
+/* asset 238 line 2 */ var x2 = 476;
+/* asset 238 line 3 */ var x3 = 714;
+/* asset 238 line 4 */ var x4 = 952;
+/* asset 238 line 5 */ var x5 = 1190;
+/* asset 238 line 6 */ var x6 = 1428;
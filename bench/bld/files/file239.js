@@ -0,0 +1,8 @@
+/* asset 239 line 0 */ var x0 = 0;
+/* asset 239 line 1 */ var x1 = 239;
+/* asset 239 line 2 */ var x2 = 478;
+/* asset 239 line 3 */ var x3 = 717;
+/* asset 239 line 4 */ var x4 = 956;
+/* asset 239 line 5 */ var x5 = 1195;
+/* asset 239 line 6 */ var x6 = 1434;
+/* asset 239 line 7 */ var x7 = 1673;
@@ -0,0 +1 @@
+/* asset 24 line 0 */ var x0 = 0;
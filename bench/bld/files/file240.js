@@ -0,0 +1 @@
+/* asset 240 line 0 */ var x0 = 0;
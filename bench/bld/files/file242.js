@@ -0,0 +1,3 @@
+/* asset 242 line 0 */ var x0 = 0;
+/* asset 242 line 1 */ var x1 = 242;
+/* asset 242 line 2 */ var x2 = 484;
@@ -0,0 +1,4 @@
+/* asset 243 line 0 */ var x0 = 0;
+/* asset 243 line 1 */ var x1 = 243;
+/* asset 243 line 2 */ var x2 = 486;
+/* asset 243 line 3 */ var x3 = 729;
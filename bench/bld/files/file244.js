@@ -0,0 +1,5 @@
+/* asset 244 line 0 */ var x0 = 0;
+/* asset 244 line 1 */ var x1 = 244;
+/* asset 244 line 2 */ var x2 = 488;
+/* asset 244 line 3 */ var x3 = 732;
+/* asset 244 line 4 */ var x4 = 976;
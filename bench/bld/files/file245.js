@@ -0,0 +1,6 @@
+/* asset 245 line 0 */ var x0 = 0;
+/* asset 245 line 1 */ var x1 = 245;
+/* asset 245 line 2 */ var x2 = 490;
+/* asset 245 line 3 */ var x3 = 735;
+/* asset 245 line 4 */ var x4 = 980;
+/* asset 245 line 5 */ var x5 = 1225;
@@ -0,0 +1,7 @@
+/* asset 246 line 0 */ var x0 = 0;
+/* asset 246 line 1 */ var x1 = 246;
+/* asset 246 line 2 */ var x2 = 492;
+/* asset 246 line 3 */ var x3 = 738;
+/* asset 246 line 4 */ var x4 = 984;
+/* asset 246 line 5 */ var x5 = 1230;
+/* asset 246 line 6 */ var x6 = 1476;
@@ -0,0 +1,8 @@
+/* asset 247 line 0 */ var x0 = 0;
+/* asset 247 line 1 */ var x1 = 247;
+/* asset 247 line 2 */ var x2 = 494;
+/* asset 247 line 3 */ var x3 = 741;
+/* asset 247 line 4 */ var x4 = 988;
+/* asset 247 line 5 */ var x5 = 1235;
+/* asset 247 line 6 */ var x6 = 1482;
+/* asset 247 line 7 */ var x7 = 1729;
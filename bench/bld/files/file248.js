@@ -0,0 +1 @@
+/* asset 248 line 0 */ var x0 = 0;
@@ -0,0 +1,2 @@
+/* asset 249 line 0 */ var x0 = 0;
+/* asset 249 line 1 */ var x1 = 249;
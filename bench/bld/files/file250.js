@@ -0,0 +1,3 @@
+/* asset 250 line 0 */ var x0 = 0;
+/* asset 250 line 1 */ var x1 = 250;
+/* asset 250 line 2 */ var x2 = 500;
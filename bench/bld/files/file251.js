@@ -0,0 +1,4 @@
+/* asset 251 line 0 */ var x0 = 0;
+/* asset 251 line 1 */ var x1 = 251;
+/* asset 251 line 2 */ var x2 = 502;
+/* asset 251 line 3 */ var x3 = 753;
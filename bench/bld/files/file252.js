@@ -0,0 +1,5 @@
+/* asset 252 line 0 */ var x0 = 0;
+/* asset 252 line 1 */ var x1 = 252;
+/* asset 252 line 2 */ var x2 = 504;
+/* asset 252 line 3 */ var x3 = 756;
+/* asset 252 line 4 */ var x4 = 1008;
@@ -0,0 +1,6 @@
+/* asset 253 line 0 */ var x0 = 0;
+/* asset 253 line 1 */ var x1 = 253;
+/* asset 253 line 2 */ var x2 = 506;
+/* asset 253 line 3 */ var x3 = 759;
+/* asset 253 line 4 */ var x4 = 1012;
+/* asset 253 line 5 */ var x5 = 1265;
@@ -0,0 +1,7 @@
+/* asset 254 line 0 */ var x0 = 0;
+/* asset 254 line 1 */ var x1 = 254;
+/* asset 254 line 2 */ var x2 = 508;
+/* asset 254 line 3 */ var x3 = 762;
+/* asset 254 line 4 */ var x4 = 1016;
+/* asset 254 line 5 */ var x5 = 1270;
+/* asset 254 line 6 */ var x6 = 1524;
@@ -0,0 +1,8 @@
+/* asset 255 line 0 */ var x0 = 0;
+/* asset 255 line 1 */ var x1 = 255;
+/* asset 255 line 2 */ var x2 = 510;
+/* asset 255 line 3 */ var x3 = 765;
+/* asset 255 line 4 */ var x4 = 1020;
+/* asset 255 line 5 */ var x5 = 1275;
+/* asset 255 line 6 */ var x6 = 1530;
+/* asset 255 line 7 */ var x7 = 1785;
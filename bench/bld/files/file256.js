@@ -0,0 +1 @@
+/* asset 256 line 0 */ var x0 = 0;
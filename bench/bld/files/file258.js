@@ -0,0 +1,3 @@
+/* asset 258 line 0 */ var x0 = 0;
+/* asset 258 line 1 */ var x1 = 258;
+/* asset 258 line 2 */ var x2 = 516;
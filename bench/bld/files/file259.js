@@ -0,0 +1,4 @@
+/* asset 259 line 0 */ var x0 = 0;
+/* asset 259 line 1 */ var x1 = 259;
+/* asset 259 line 2 */ var x2 = 518;
+/* asset 259 line 3 */ var x3 = 777;
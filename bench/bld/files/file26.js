@@ -0,0 +1,3 @@
+/* asset 26 line 0 */ var x0 = 0;
+/* asset 26 line 1 */ var x1 = 26;
+/* asset 26 line 2 */ var x2 = 52;
@@ -0,0 +1,5 @@
+/* asset 260 line 0 */ var x0 = 0;
+/* asset 260 line 1 */ var x1 = 260;
+/* asset 260 line 2 */ var x2 = 520;
+/* asset 260 line 3 */ var x3 = 780;
+/* asset 260 line 4 */ var x4 = 1040;
@@ -0,0 +1,6 @@
+/* asset 261 line 0 */ var x0 = 0;
+/* asset 261 line 1 */ var x1 = 261;
+/* asset 261 line 2 */ var x2 = 522;
+/* asset 261 line 3 */ var x3 = 783;
+/* asset 261 line 4 */ var x4 = 1044;
+/* asset 261 line 5 */ var x5 = 1305;
@@ -0,0 +1,7 @@
+/* asset 262 line 0 */ var x0 = 0;
+/* asset 262 line 1 */ var x1 = 262;
+/* asset 262 line 2 */ var x2 = 524;
+/* asset 262 line 3 */ var x3 = 786;
+/* asset 262 line 4 */ var x4 = 1048;
+/* asset 262 line 5 */ var x5 = 1310;
+/* asset 262 line 6 */ var x6 = 1572;
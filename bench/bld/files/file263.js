@@ -0,0 +1,8 @@
+/* asset 263 line 0 */ var x0 = 0;
+/* asset 263 line 1 */ var x1 = 263;
+/* asset 263 line 2 */ var x2 = 526;
+/* asset 263 line 3 */ var x3 = 789;
+/* asset 263 line 4 */ var x4 = 1052;
+/* asset 263 line 5 */ var x5 = 1315;
+/* asset 263 line 6 */ var x6 = 1578;
+/* asset 263 line 7 */ var x7 = 1841;
@@ -0,0 +1 @@
+/* asset 264 line 0 */ var x0 = 0;
@@ -0,0 +1,3 @@
+/* asset 266 line 0 */ var x0 = 0;
+/* asset 266 line 1 */ var x1 = 266;
+/* asset 266 line 2 */ var x2 = 532;
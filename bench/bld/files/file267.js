@@ -0,0 +1,4 @@
+/* asset 267 line 0 */ var x0 = 0;
+/* asset 267 line 1 */ var x1 = 267;
+/* asset 267 line 2 */ var x2 = 534;
+/* asset 267 line 3 */ var x3 = 801;
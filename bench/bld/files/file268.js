@@ -0,0 +1,5 @@
+/* asset 268 line 0 */ var x0 = 0;
+/* asset 268 line 1 */ var x1 = 268;
+/* asset 268 line 2 */ var x2 = 536;
+/* asset 268 line 3 */ var x3 = 804;
+/* asset 268 line 4 */ var x4 = 1072;
@@ -0,0 +1,6 @@
+/* asset 269 line 0 */ var x0 = 0;
+/* asset 269 line 1 */ var x1 = 269;
+/* asset 269 line 2 */ var x2 = 538;
+/* asset 269 line 3 */ var x3 = 807;
+/* asset 269 line 4 */ var x4 = 1076;
+/* asset 269 line 5 */ var x5 = 1345;
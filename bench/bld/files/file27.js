@@ -0,0 +1,4 @@
+/* asset 27 line 0 */ var x0 = 0;
+/* asset 27 line 1 */ var x1 = 27;
+/* asset 27 line 2 */ var x2 = 54;
+/* asset 27 line 3 */ var x3 = 81;
@@ -0,0 +1,7 @@
+/* asset 270 line 0 */ var x0 = 0;
+/* asset 270 line 1 */ var x1 = 270;
+/* asset 270 line 2 */ var x2 = 540;
+/* asset 270 line 3 */ var x3 = 810;
+/* asset 270 line 4 */ var x4 = 1080;
+/* asset 270 line 5 */ var x5 = 1350;
+/* asset 270 line 6 */ var x6 = 1620;
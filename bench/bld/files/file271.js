@@ -0,0 +1,8 @@
+/* asset 271 line 0 */ var x0 = 0;
+/* asset 271 line 1 */ var x1 = 271;
+/* asset 271 line 2 */ var x2 = 542;
+/* asset 271 line 3 */ var x3 = 813;
+/* asset 271 line 4 */ var x4 = 1084;
+/* asset 271 line 5 */ var x5 = 1355;
+/* asset 271 line 6 */ var x6 = 1626;
+/* asset 271 line 7 */ var x7 = 1897;
@@ -0,0 +1 @@
+/* asset 272 line 0 */ var x0 = 0;
@@ -0,0 +1,3 @@
+/* asset 274 line 0 */ var x0 = 0;
+/* asset 274 line 1 */ var x1 = 274;
+/* asset 274 line 2 */ var x2 = 548;
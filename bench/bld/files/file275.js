@@ -0,0 +1,4 @@
+/* asset 275 line 0 */ var x0 = 0;
+/* asset 275 line 1 */ var x1 = 275;
+/* asset 275 line 2 */ var x2 = 550;
+/* asset 275 line 3 */ var x3 = 825;
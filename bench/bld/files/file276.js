@@ -0,0 +1,5 @@
+/* asset 276 line 0 */ var x0 = 0;
+/* asset 276 line 1 */ var x1 = 276;
+/* asset 276 line 2 */ var x2 = 552;
+/* asset 276 line 3 */ var x3 = 828;
+/* asset 276 line 4 */ var x4 = 1104;
@@ -0,0 +1,6 @@
+/* asset 277 line 0 */ var x0 = 0;
+/* asset 277 line 1 */ var x1 = 277;
+/* asset 277 line 2 */ var x2 = 554;
+/* asset 277 line 3 */ var x3 = 831;
+/* asset 277 line 4 */ var x4 = 1108;
+/* asset 277 line 5 */ var x5 = 1385;
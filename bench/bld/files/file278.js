@@ -0,0 +1,7 @@
+/* asset 278 line 0 */ var x0 = 0;
+/* asset 278 line 1 */ var x1 = 278;
+/* asset 278 line 2 */ var x2 = 556;
+/* asset 278 line 3 */ var x3 = 834;
+/* asset 278 line 4 */ var x4 = 1112;
+/* asset 278 line 5 */ var x5 = 1390;
+/* asset 278 line 6 */ var x6 = 1668;
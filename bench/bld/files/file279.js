@@ -0,0 +1,8 @@
+/* asset 279 line 0 */ var x0 = 0;
+/* asset 279 line 1 */ var x1 = 279;
+/* asset 279 line 2 */ var x2 = 558;
+/* asset 279 line 3 */ var x3 = 837;
+/* asset 279 line 4 */ var x4 = 1116;
+/* asset 279 line 5 */ var x5 = 1395;
+/* asset 279 line 6 */ var x6 = 1674;
+/* asset 279 line 7 */ var x7 = 1953;
@@ -0,0 +1,5 @@
+/* asset 28 line 0 */ var x0 = 0;
+/* asset 28 line 1 */ var x1 = 28;
+/* asset 28 line 2 */ var x2 = 56;
+/* asset 28 line 3 */ var x3 = 84;
+/* asset 28 line 4 */ var x4 = 112;
@@ -0,0 +1 @@
+/* asset 280 line 0 */ var x0 = 0;
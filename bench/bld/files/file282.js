@@ -0,0 +1,3 @@
+/* asset 282 line 0 */ var x0 = 0;
+/* asset 282 line 1 */ var x1 = 282;
+/* asset 282 line 2 */ var x2 = 564;
@@ -0,0 +1,4 @@
+/* asset 283 line 0 */ var x0 = 0;
+/* asset 283 line 1 */ var x1 = 283;
+/* asset 283 line 2 */ var x2 = 566;
+/* asset 283 line 3 */ var x3 = 849;
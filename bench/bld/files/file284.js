@@ -0,0 +1,5 @@
+/* asset 284 line 0 */ var x0 = 0;
+/* asset 284 line 1 */ var x1 = 284;
+/* asset 284 line 2 */ var x2 = 568;
+/* asset 284 line 3 */ var x3 = 852;
+/* asset 284 line 4 */ var x4 = 1136;
@@ -0,0 +1,6 @@
+/* asset 285 line 0 */ var x0 = 0;
+/* asset 285 line 1 */ var x1 = 285;
+/* asset 285 line 2 */ var x2 = 570;
+/* asset 285 line 3 */ var x3 = 855;
+/* asset 285 line 4 */ var x4 = 1140;
+/* asset 285 line 5 */ var x5 = 1425;
@@ -0,0 +1,7 @@
+/* asset 286 line 0 */ var x0 = 0;
+/* asset 286 line 1 */ var x1 = 286;
+/* asset 286 line 2 */ var x2 = 572;
+/* asset 286 line 3 */ var x3 = 858;
+/* asset 286 line 4 */ var x4 = 1144;
+/* asset 286 line 5 */ var x5 = 1430;
+/* asset 286 line 6 */ var x6 = 1716;
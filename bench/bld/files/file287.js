@@ -0,0 +1,8 @@
+/* asset 287 line 0 */ var x0 = 0;
+/* asset 287 line 1 */ var x1 = 287;
+/* asset 287 line 2 */ var x2 = 574;
+/* asset 287 line 3 */ var x3 = 861;
+/* asset 287 line 4 */ var x4 = 1148;
+/* asset 287 line 5 */ var x5 = 1435;
+/* asset 287 line 6 */ var x6 = 1722;
+/* asset 287 line 7 */ var x7 = 2009;
@@ -0,0 +1 @@
+/* asset 288 line 0 */ var x0 = 0;
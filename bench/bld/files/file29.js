@@ -0,0 +1,6 @@
+/* asset 29 line 0 */ var x0 = 0;
+/* asset 29 line 1 */ var x1 = 29;
+/* asset 29 line 2 */ var x2 = 58;
+/* asset 29 line 3 */ var x3 = 87;
+/* asset 29 line 4 */ var x4 = 116;
+/* asset 29 line 5 */ var x5 = 145;
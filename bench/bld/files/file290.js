@@ -0,0 +1,3 @@
+/* asset 290 line 0 */ var x0 = 0;
+/* asset 290 line 1 */ var x1 = 290;
+/* asset 290 line 2 */ var x2 = 580;
@@ -0,0 +1,4 @@
+/* asset 291 line 0 */ var x0 = 0;
+/* asset 291 line 1 */ var x1 = 291;
+/* asset 291 line 2 */ var x2 = 582;
+/* asset 291 line 3 */ var x3 = 873;
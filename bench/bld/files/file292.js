@@ -0,0 +1,5 @@
+/* asset 292 line 0 */ var x0 = 0;
+/* asset 292 line 1 */ var x1 = 292;
+/* asset 292 line 2 */ var x2 = 584;
+/* asset 292 line 3 */ var x3 = 876;
+/* asset 292 line 4 */ var x4 = 1168;
@@ -0,0 +1,6 @@
+/* asset 293 line 0 */ var x0 = 0;
+/* asset 293 line 1 */ var x1 = 293;
+/* asset 293 line 2 */ var x2 = 586;
+/* asset 293 line 3 */ var x3 = 879;
+/* asset 293 line 4 */ var x4 = 1172;
+/* asset 293 line 5 */ var x5 = 1465;
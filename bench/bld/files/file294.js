@@ -0,0 +1,7 @@
+/* asset 294 line 0 */ var x0 = 0;
+/* asset 294 line 1 */ var x1 = 294;
+/* asset 294 line 2 */ var x2 = 588;
+/* asset 294 line 3 */ var x3 = 882;
+/* asset 294 line 4 */ var x4 = 1176;
+/* asset 294 line 5 */ var x5 = 1470;
+/* asset 294 line 6 */ var x6 = 1764;
@@ -0,0 +1,8 @@
+/* asset 295 line 0 */ var x0 = 0;
+/* asset 295 line 1 */ var x1 = 295;
+/* asset 295 line 2 */ var x2 = 590;
+/* asset 295 line 3 */ var x3 = 885;
+/* asset 295 line 4 */ var x4 = 1180;
+/* asset 295 line 5 */ var x5 = 1475;
+/* asset 295 line 6 */ var x6 = 1770;
+/* asset 295 line 7 */ var x7 = 2065;
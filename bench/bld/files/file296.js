@@ -0,0 +1 @@
+/* asset 296 line 0 */ var x0 = 0;
@@ -0,0 +1,3 @@
+/* asset 298 line 0 */ var x0 = 0;
+/* asset 298 line 1 */ var x1 = 298;
+/* asset 298 line 2 */ var x2 = 596;
@@ -0,0 +1,4 @@
+/* asset 299 line 0 */ var x0 = 0;
+/* asset 299 line 1 */ var x1 = 299;
+/* asset 299 line 2 */ var x2 = 598;
+/* asset 299 line 3 */ var x3 = 897;
@@ -0,0 +1,4 @@
+/* asset 3 line 0 */ var x0 = 0;
+/* asset 3 line 1 */ var x1 = 3;
+/* asset 3 line 2 */ var x2 = 6;
+/* asset 3 line 3 */ var x3 = 9;
@@ -0,0 +1,7 @@
+/* asset 30 line 0 */ var x0 = 0;
+/* asset 30 line 1 */ var x1 = 30;
+/* asset 30 line 2 */ var x2 = 60;
+/* asset 30 line 3 */ var x3 = 90;
+/* asset 30 line 4 */ var x4 = 120;
+/* asset 30 line 5 */ var x5 = 150;
+/* asset 30 line 6 */ var x6 = 180;
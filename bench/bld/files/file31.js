@@ -0,0 +1,8 @@
+/* asset 31 line 0 */ var x0 = 0;
+/* asset 31 line 1 */ var x1 = 31;
+/* asset 31 line 2 */ var x2 = 62;
+/* asset 31 line 3 */ var x3 = 93;
+/* asset 31 line 4 */ var x4 = 124;
+/* asset 31 line 5 */ var x5 = 155;
+/* asset 31 line 6 */ var x6 = 186;
+/* asset 31 line 7 */ var x7 = 217;
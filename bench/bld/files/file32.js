@@ -0,0 +1 @@
+/* asset 32 line 0 */ var x0 = 0;
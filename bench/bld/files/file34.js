@@ -0,0 +1,3 @@
+/* asset 34 line 0 */ var x0 = 0;
+/* asset 34 line 1 */ var x1 = 34;
+/* asset 34 line 2 */ var x2 = 68;
@@ -0,0 +1,4 @@
+/* asset 35 line 0 */ var x0 = 0;
+/* asset 35 line 1 */ var x1 = 35;
+/* asset 35 line 2 */ var x2 = 70;
+/* asset 35 line 3 */ var x3 = 105;
@@ -0,0 +1,5 @@
+/* asset 36 line 0 */ var x0 = 0;
+/* asset 36 line 1 */ var x1 = 36;
+/* asset 36 line 2 */ var x2 = 72;
+/* asset 36 line 3 */ var x3 = 108;
+/* asset 36 line 4 */ var x4 = 144;
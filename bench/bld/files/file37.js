@@ -0,0 +1,6 @@
+/* asset 37 line 0 */ var x0 = 0;
+/* asset 37 line 1 */ var x1 = 37;
+/* asset 37 line 2 */ var x2 = 74;
+/* asset 37 line 3 */ var x3 = 111;
+/* asset 37 line 4 */ var x4 = 148;
+/* asset 37 line 5 */ var x5 = 185;
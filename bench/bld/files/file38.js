@@ -0,0 +1,7 @@
+/* asset 38 line 0 */ var x0 = 0;
+/* asset 38 line 1 */ var x1 = 38;
+/* asset 38 line 2 */ var x2 = 76;
+/* asset 38 line 3 */ var x3 = 114;
+/* asset 38 line 4 */ var x4 = 152;
+/* asset 38 line 5 */ var x5 = 190;
+/* asset 38 line 6 */ var x6 = 228;
@@ -0,0 +1,8 @@
+/* asset 39 line 0 */ var x0 = 0;
+/* asset 39 line 1 */ var x1 = 39;
+/* asset 39 line 2 */ var x2 = 78;
+/* asset 39 line 3 */ var x3 = 117;
+/* asset 39 line 4 */ var x4 = 156;
+/* asset 39 line 5 */ var x5 = 195;
+/* asset 39 line 6 */ var x6 = 234;
+/* asset 39 line 7 */ var x7 = 273;
@@ -0,0 +1,5 @@
+/* asset 4 line 0 */ var x0 = 0;
+/* asset 4 line 1 */ var x1 = 4;
+/* asset 4 line 2 */ var x2 = 8;
+/* asset 4 line 3 */ var x3 = 12;
+/* asset 4 line 4 */ var x4 = 16;
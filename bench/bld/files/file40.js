@@ -0,0 +1 @@
+/* asset 40 line 0 */ var x0 = 0;
@@ -0,0 +1,3 @@
+/* asset 42 line 0 */ var x0 = 0;
+/* asset 42 line 1 */ var x1 = 42;
+/* asset 42 line 2 */ var x2 = 84;
@@ -0,0 +1,4 @@
+/* asset 43 line 0 */ var x0 = 0;
+/* asset 43 line 1 */ var x1 = 43;
+/* asset 43 line 2 */ var x2 = 86;
+/* asset 43 line 3 */ var x3 = 129;
@@ -0,0 +1,5 @@
+/* asset 44 line 0 */ var x0 = 0;
+/* asset 44 line 1 */ var x1 = 44;
+/* asset 44 line 2 */ var x2 = 88;
+/* asset 44 line 3 */ var x3 = 132;
+/* asset 44 line 4 */ var x4 = 176;
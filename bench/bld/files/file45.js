@@ -0,0 +1,6 @@
+/* asset 45 line 0 */ var x0 = 0;
+/* asset 45 line 1 */ var x1 = 45;
+/* asset 45 line 2 */ var x2 = 90;
+/* asset 45 line 3 */ var x3 = 135;
+/* asset 45 line 4 */ var x4 = 180;
+/* asset 45 line 5 */ var x5 = 225;
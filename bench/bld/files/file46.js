@@ -0,0 +1,7 @@
+/* asset 46 line 0 */ var x0 = 0;
+/* asset 46 line 1 */ var x1 = 46;
+/* asset 46 line 2 */ var x2 = 92;
+/* asset 46 line 3 */ var x3 = 138;
+/* asset 46 line 4 */ var x4 = 184;
+/* asset 46 line 5 */ var x5 = 230;
+/* asset 46 line 6 */ var x6 = 276;
@@ -0,0 +1,8 @@
+/* asset 47 line 0 */ var x0 = 0;
+/* asset 47 line 1 */ var x1 = 47;
+/* asset 47 line 2 */ var x2 = 94;
+/* asset 47 line 3 */ var x3 = 141;
+/* asset 47 line 4 */ var x4 = 188;
+/* asset 47 line 5 */ var x5 = 235;
+/* asset 47 line 6 */ var x6 = 282;
+/* asset 47 line 7 */ var x7 = 329;
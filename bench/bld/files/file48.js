@@ -0,0 +1 @@
+/* asset 48 line 0 */ var x0 = 0;
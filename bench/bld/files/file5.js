@@ -0,0 +1,6 @@
+/* asset 5 line 0 */ var x0 = 0;
+/* asset 5 line 1 */ var x1 = 5;
+/* asset 5 line 2 */ var x2 = 10;
+/* asset 5 line 3 */ var x3 = 15;
+/* asset 5 line 4 */ var x4 = 20;
+/* asset 5 line 5 */ var x5 = 25;
@@ -0,0 +1,3 @@
+/* asset 50 line 0 */ var x0 = 0;
+/* asset 50 line 1 */ var x1 = 50;
+/* asset 50 line 2 */ var x2 = 100;
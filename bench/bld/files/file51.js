@@ -0,0 +1,4 @@
+/* asset 51 line 0 */ var x0 = 0;
+/* asset 51 line 1 */ var x1 = 51;
+/* asset 51 line 2 */ var x2 = 102;
+/* asset 51 line 3 */ var x3 = 153;
@@ -0,0 +1,5 @@
+/* asset 52 line 0 */ var x0 = 0;
+/* asset 52 line 1 */ var x1 = 52;
+/* asset 52 line 2 */ var x2 = 104;
+/* asset 52 line 3 */ var x3 = 156;
+/* asset 52 line 4 */ var x4 = 208;
@@ -0,0 +1,6 @@
+/* asset 53 line 0 */ var x0 = 0;
+/* asset 53 line 1 */ var x1 = 53;
+/* asset 53 line 2 */ var x2 = 106;
+/* asset 53 line 3 */ var x3 = 159;
+/* asset 53 line 4 */ var x4 = 212;
+/* asset 53 line 5 */ var x5 = 265;
@@ -0,0 +1,7 @@
+/* asset 54 line 0 */ var x0 = 0;
+/* asset 54 line 1 */ var x1 = 54;
+/* asset 54 line 2 */ var x2 = 108;
+/* asset 54 line 3 */ var x3 = 162;
+/* asset 54 line 4 */ var x4 = 216;
+/* asset 54 line 5 */ var x5 = 270;
+/* asset 54 line 6 */ var x6 = 324;
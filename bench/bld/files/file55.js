@@ -0,0 +1,8 @@
+/* asset 55 line 0 */ var x0 = 0;
+/* asset 55 line 1 */ var x1 = 55;
+/* asset 55 line 2 */ var x2 = 110;
+/* asset 55 line 3 */ var x3 = 165;
+/* asset 55 line 4 */ var x4 = 220;
+/* asset 55 line 5 */ var x5 = 275;
+/* asset 55 line 6 */ var x6 = 330;
+/* asset 55 line 7 */ var x7 = 385;
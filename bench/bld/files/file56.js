@@ -0,0 +1 @@
+/* asset 56 line 0 */ var x0 = 0;
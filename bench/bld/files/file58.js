@@ -0,0 +1,3 @@
+/* asset 58 line 0 */ var x0 = 0;
+/* asset 58 line 1 */ var x1 = 58;
+/* asset 58 line 2 */ var x2 = 116;
@@ -0,0 +1,4 @@
+/* asset 59 line 0 */ var x0 = 0;
+/* asset 59 line 1 */ var x1 = 59;
+/* asset 59 line 2 */ var x2 = 118;
+/* asset 59 line 3 */ var x3 = 177;
@@ -0,0 +1,7 @@
+/* asset 6 line 0 */ var x0 = 0;
+/* asset 6 line 1 */ var x1 = 6;
+/* asset 6 line 2 */ var x2 = 12;
+/* asset 6 line 3 */ var x3 = 18;
+/* asset 6 line 4 */ var x4 = 24;
+/* asset 6 line 5 */ var x5 = 30;
+/* asset 6 line 6 */ var x6 = 36;
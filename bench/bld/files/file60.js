@@ -0,0 +1,5 @@
+/* asset 60 line 0 */ var x0 = 0;
+/* asset 60 line 1 */ var x1 = 60;
+/* asset 60 line 2 */ var x2 = 120;
+/* asset 60 line 3 */ var x3 = 180;
+/* asset 60 line 4 */ var x4 = 240;
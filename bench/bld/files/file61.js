@@ -0,0 +1,6 @@
+/* asset 61 line 0 */ var x0 = 0;
+/* asset 61 line 1 */ var x1 = 61;
+/* asset 61 line 2 */ var x2 = 122;
+/* asset 61 line 3 */ var x3 = 183;
+/* asset 61 line 4 */ var x4 = 244;
+/* asset 61 line 5 */ var x5 = 305;
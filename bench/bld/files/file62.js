@@ -0,0 +1,7 @@
+/* asset 62 line 0 */ var x0 = 0;
+/* asset 62 line 1 */ var x1 = 62;
+/* asset 62 line 2 */ var x2 = 124;
+/* asset 62 line 3 */ var x3 = 186;
+/* asset 62 line 4 */ var x4 = 248;
+/* asset 62 line 5 */ var x5 = 310;
+/* asset 62 line 6 */ var x6 = 372;
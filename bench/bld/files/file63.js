@@ -0,0 +1,8 @@
+/* asset 63 line 0 */ var x0 = 0;
+/* asset 63 line 1 */ var x1 = 63;
+/* asset 63 line 2 */ var x2 = 126;
+/* asset 63 line 3 */ var x3 = 189;
+/* asset 63 line 4 */ var x4 = 252;
+/* asset 63 line 5 */ var x5 = 315;
+/* asset 63 line 6 */ var x6 = 378;
+/* asset 63 line 7 */ var x7 = 441;
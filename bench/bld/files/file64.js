@@ -0,0 +1 @@
+/* asset 64 line 0 */ var x0 = 0;
@@ -0,0 +1,3 @@
+/* asset 66 line 0 */ var x0 = 0;
+/* asset 66 line 1 */ var x1 = 66;
+/* asset 66 line 2 */ var x2 = 132;
@@ -0,0 +1,4 @@
+/* asset 67 line 0 */ var x0 = 0;
+/* asset 67 line 1 */ var x1 = 67;
+/* asset 67 line 2 */ var x2 = 134;
+/* asset 67 line 3 */ var x3 = 201;
@@ -0,0 +1,5 @@
+/* asset 68 line 0 */ var x0 = 0;
+/* asset 68 line 1 */ var x1 = 68;
+/* asset 68 line 2 */ var x2 = 136;
+/* asset 68 line 3 */ var x3 = 204;
+/* asset 68 line 4 */ var x4 = 272;
@@ -0,0 +1,6 @@
+/* asset 69 line 0 */ var x0 = 0;
+/* asset 69 line 1 */ var x1 = 69;
+/* asset 69 line 2 */ var x2 = 138;
+/* asset 69 line 3 */ var x3 = 207;
+/* asset 69 line 4 */ var x4 = 276;
+/* asset 69 line 5 */ var x5 = 345;
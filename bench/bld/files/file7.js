@@ -0,0 +1,8 @@
+/* asset 7 line 0 */ var x0 = 0;
+/* asset 7 line 1 */ var x1 = 7;
+/* asset 7 line 2 */ var x2 = 14;
+/* asset 7 line 3 */ var x3 = 21;
+/* asset 7 line 4 */ var x4 = 28;
+/* asset 7 line 5 */ var x5 = 35;
+/* asset 7 line 6 */ var x6 = 42;
+/* asset 7 line 7 */ var x7 = 49;
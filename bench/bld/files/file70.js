@@ -0,0 +1,7 @@
+/* asset 70 line 0 */ var x0 = 0;
+/* asset 70 line 1 */ var x1 = 70;
+/* asset 70 line 2 */ var x2 = 140;
+/* asset 70 line 3 */ var x3 = 210;
+/* asset 70 line 4 */ var x4 = 280;
+/* asset 70 line 5 */ var x5 = 350;
+/* asset 70 line 6 */ var x6 = 420;
@@ -0,0 +1,8 @@
+/* asset 71 line 0 */ var x0 = 0;
+/* asset 71 line 1 */ var x1 = 71;
+/* asset 71 line 2 */ var x2 = 142;
+/* asset 71 line 3 */ var x3 = 213;
+/* asset 71 line 4 */ var x4 = 284;
+/* asset 71 line 5 */ var x5 = 355;
+/* asset 71 line 6 */ var x6 = 426;
+/* asset 71 line 7 */ var x7 = 497;
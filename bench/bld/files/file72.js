@@ -0,0 +1 @@
+/* asset 72 line 0 */ var x0 = 0;
@@ -0,0 +1,3 @@
+/* asset 74 line 0 */ var x0 = 0;
+/* asset 74 line 1 */ var x1 = 74;
+/* asset 74 line 2 */ var x2 = 148;
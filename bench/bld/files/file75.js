@@ -0,0 +1,4 @@
+/* asset 75 line 0 */ var x0 = 0;
+/* asset 75 line 1 */ var x1 = 75;
+/* asset 75 line 2 */ var x2 = 150;
+/* asset 75 line 3 */ var x3 = 225;
@@ -0,0 +1,5 @@
+/* asset 76 line 0 */ var x0 = 0;
+/* asset 76 line 1 */ var x1 = 76;
+/* asset 76 line 2 */ var x2 = 152;
+/* asset 76 line 3 */ var x3 = 228;
+/* asset 76 line 4 */ var x4 = 304;
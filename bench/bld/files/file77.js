@@ -0,0 +1,6 @@
+/* asset 77 line 0 */ var x0 = 0;
+/* asset 77 line 1 */ var x1 = 77;
+/* asset 77 line 2 */ var x2 = 154;
+/* asset 77 line 3 */ var x3 = 231;
+/* asset 77 line 4 */ var x4 = 308;
+/* asset 77 line 5 */ var x5 = 385;
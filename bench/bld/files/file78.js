@@ -0,0 +1,7 @@
+/* asset 78 line 0 */ var x0 = 0;
+/* asset 78 line 1 */ var x1 = 78;
+/* asset 78 line 2 */ var x2 = 156;
+/* asset 78 line 3 */ var x3 = 234;
+/* asset 78 line 4 */ var x4 = 312;
+/* asset 78 line 5 */ var x5 = 390;
+/* asset 78 line 6 */ var x6 = 468;
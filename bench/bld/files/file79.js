@@ -0,0 +1,8 @@
+/* asset 79 line 0 */ var x0 = 0;
+/* asset 79 line 1 */ var x1 = 79;
+/* asset 79 line 2 */ var x2 = 158;
+/* asset 79 line 3 */ var x3 = 237;
+/* asset 79 line 4 */ var x4 = 316;
+/* asset 79 line 5 */ var x5 = 395;
+/* asset 79 line 6 */ var x6 = 474;
+/* asset 79 line 7 */ var x7 = 553;
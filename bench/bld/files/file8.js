@@ -0,0 +1 @@
+/* asset 8 line 0 */ var x0 = 0;
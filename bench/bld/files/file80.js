@@ -0,0 +1 @@
+/* asset 80 line 0 */ var x0 = 0;
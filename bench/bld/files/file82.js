@@ -0,0 +1,3 @@
+/* asset 82 line 0 */ var x0 = 0;
+/* asset 82 line 1 */ var x1 = 82;
+/* asset 82 line 2 */ var x2 = 164;
@@ -0,0 +1,4 @@
+/* asset 83 line 0 */ var x0 = 0;
+/* asset 83 line 1 */ var x1 = 83;
+/* asset 83 line 2 */ var x2 = 166;
+/* asset 83 line 3 */ var x3 = 249;
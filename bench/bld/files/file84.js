@@ -0,0 +1,5 @@
+/* asset 84 line 0 */ var x0 = 0;
+/* asset 84 line 1 */ var x1 = 84;
+/* asset 84 line 2 */ var x2 = 168;
+/* asset 84 line 3 */ var x3 = 252;
+/* asset 84 line 4 */ var x4 = 336;
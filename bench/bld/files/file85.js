@@ -0,0 +1,6 @@
+/* asset 85 line 0 */ var x0 = 0;
+/* asset 85 line 1 */ var x1 = 85;
+/* asset 85 line 2 */ var x2 = 170;
+/* asset 85 line 3 */ var x3 = 255;
+/* asset 85 line 4 */ var x4 = 340;
+/* asset 85 line 5 */ var x5 = 425;
@@ -0,0 +1,7 @@
+/* asset 86 line 0 */ var x0 = 0;
+/* asset 86 line 1 */ var x1 = 86;
+/* asset 86 line 2 */ var x2 = 172;
+/* asset 86 line 3 */ var x3 = 258;
+/* asset 86 line 4 */ var x4 = 344;
+/* asset 86 line 5 */ var x5 = 430;
+/* asset 86 line 6 */ var x6 = 516;
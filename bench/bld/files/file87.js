@@ -0,0 +1,8 @@
+/* asset 87 line 0 */ var x0 = 0;
+/* asset 87 line 1 */ var x1 = 87;
+/* asset 87 line 2 */ var x2 = 174;
+/* asset 87 line 3 */ var x3 = 261;
+/* asset 87 line 4 */ var x4 = 348;
+/* asset 87 line 5 */ var x5 = 435;
+/* asset 87 line 6 */ var x6 = 522;
+/* asset 87 line 7 */ var x7 = 609;
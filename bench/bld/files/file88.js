@@ -0,0 +1 @@
+/* asset 88 line 0 */ var x0 = 0;
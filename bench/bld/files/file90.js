@@ -0,0 +1,3 @@
+/* asset 90 line 0 */ var x0 = 0;
+/* asset 90 line 1 */ var x1 = 90;
+/* asset 90 line 2 */ var x2 = 180;
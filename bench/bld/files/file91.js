@@ -0,0 +1,4 @@
+/* asset 91 line 0 */ var x0 = 0;
+/* asset 91 line 1 */ var x1 = 91;
+/* asset 91 line 2 */ var x2 = 182;
+/* asset 91 line 3 */ var x3 = 273;
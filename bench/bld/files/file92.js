@@ -0,0 +1,5 @@
+/* asset 92 line 0 */ var x0 = 0;
+/* asset 92 line 1 */ var x1 = 92;
+/* asset 92 line 2 */ var x2 = 184;
+/* asset 92 line 3 */ var x3 = 276;
+/* asset 92 line 4 */ var x4 = 368;
@@ -0,0 +1,6 @@
+/* asset 93 line 0 */ var x0 = 0;
+/* asset 93 line 1 */ var x1 = 93;
+/* asset 93 line 2 */ var x2 = 186;
+/* asset 93 line 3 */ var x3 = 279;
+/* asset 93 line 4 */ var x4 = 372;
+/* asset 93 line 5 */ var x5 = 465;
@@ -0,0 +1,7 @@
+/* asset 94 line 0 */ var x0 = 0;
+/* asset 94 line 1 */ var x1 = 94;
+/* asset 94 line 2 */ var x2 = 188;
+/* asset 94 line 3 */ var x3 = 282;
+/* asset 94 line 4 */ var x4 = 376;
+/* asset 94 line 5 */ var x5 = 470;
+/* asset 94 line 6 */ var x6 = 564;
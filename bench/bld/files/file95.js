@@ -0,0 +1,8 @@
+/* asset 95 line 0 */ var x0 = 0;
+/* asset 95 line 1 */ var x1 = 95;
+/* asset 95 line 2 */ var x2 = 190;
+/* asset 95 line 3 */ var x3 = 285;
+/* asset 95 line 4 */ var x4 = 380;
+/* asset 95 line 5 */ var x5 = 475;
+/* asset 95 line 6 */ var x6 = 570;
+/* asset 95 line 7 */ var x7 = 665;
@@ -0,0 +1 @@
+/* asset 96 line 0 */ var x0 = 0;
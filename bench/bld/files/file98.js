@@ -0,0 +1,3 @@
+/* asset 98 line 0 */ var x0 = 0;
+/* asset 98 line 1 */ var x1 = 98;
+/* asset 98 line 2 */ var x2 = 196;
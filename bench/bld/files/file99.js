@@ -0,0 +1,4 @@
+/* asset 99 line 0 */ var x0 = 0;
+/* asset 99 line 1 */ var x1 = 99;
+/* asset 99 line 2 */ var x2 = 198;
+/* asset 99 line 3 */ var x3 = 297;